@@ -13,13 +13,57 @@
 #define PULSE_TIMER htim1
 #define UART huart1
 #define ADC hadc1
+#define ADC_SLAVE hadc2
 
+// Links a function into .ramfunc, copied to SRAM at reset (see the linker
+// script): for the interrupt chain and per-sample loops, which otherwise
+// stall on flash wait states whenever the ICACHE misses. noinline keeps the
+// body there instead of folding it into a caller in flash.
+#define RAMFUNC __attribute__((section(".ramfunc"), noinline))
+
+// SRAM bank placement, see the MEMORY comment in the linker script. DMA
+// targets go to SRAM2, buffers the processing loops work on to SRAM3, the
+// stack and everything else stays in SRAM1. Both are zeroed at reset.
+#define DMA_BUFFER __attribute__((section(".dma_buffer")))
+#define DSP_DATA __attribute__((section(".dsp_data")))
+
+// Boot defaults, the command channel can change these at runtime
 static const uint8_t DEBUG_MODE = 0;
+static const uint8_t STREAM_MODE = 0;
 static const uint8_t ENABLE_BUZZER = 1;
+static const uint8_t PULSE_SYNC_MODE = 1;
+static const uint16_t STACK_DEPTH = 16;
+static const uint8_t ACQ_PROFILE = 0;
+static const uint8_t DETECT_K_ON = 5;
+static const uint8_t DETECT_K_OFF = 3;
+static const float SLOW_ALPHA = 0.0005f;
+static const float FAST_ALPHA = 0.1f;
+static const uint16_t PROFILER_DUMP_MS = 0; // 0: the profiler counts but sends nothing
+
+// Detector constants, fixed at build time. host/bench.c runs the same
+// detector and takes them from here. The crossing time is interpolated well
+// below a sample period (240 ns), the sigma floor sits at a fifth of that.
+static const float DETECT_NOISE_ALPHA = 0.002f;
+static const float DETECT_SIGMA_MIN_US = 0.05f;
 
 void Buzzer_Set(uint16_t freq);
-int _write(int file, char* ptr, int len);
+void Acquisition_Start(uint8_t sync);
+void Acquisition_ConfigDma(uint8_t packed, uint8_t circular);
+void Acquisition_StartDma(volatile uint16_t* buffer, uint16_t samples);
+void Acquisition_SetProfile(uint8_t profile);
+void Acquisition_SetBurstDelay(uint16_t ticks);
+void Stacking_SetDepth(uint16_t depth);
+void Pulse_Report(const uint16_t* samples, uint16_t count, uint32_t timeNsQ8, float val);
+void Record_Report(const uint16_t* record, uint16_t count);
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
 void HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADCEx_LevelOutOfWindow2Callback(ADC_HandleTypeDef *hadc);
+void HAL_ADCEx_LevelOutOfWindow3Callback(ADC_HandleTypeDef *hadc);
+void HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc);
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim);
 
 void GitKop_Init();
@@ -1,7 +1,18 @@
+#include <math.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "GitKop.h"
-#include "ema.h"
+#include "command.h"
+#include "decay.h"
+#include "detector.h"
+#include "filters.h"
+#include "profiler.h"
+#include "rice.h"
+#include "scheduler.h"
+#include "stacking.h"
+#include "telemetry.h"
+#include "uart.h"
 #include "main.h"
 #include "stm32h5xx_hal.h"
 #include "stm32h5xx_hal_dma.h"
@@ -12,80 +23,486 @@
 #include "ssd1306.h"
 #include "ssd1306_fonts.h"
 
-static uint16_t debugOutputCtr = 0;
-static uint16_t updateOledCtr = 0;
+// Work posted by the interrupts and run by GitKop_Loop, lower number first
+enum {
+    TASK_BLOCK,   // DMA half or burst complete
+    TASK_COMMAND, // UART RX, a command line may be ready
+    TASK_DISPLAY, // OLED redraw tick or the next flush slice after a block
+    TASK_PROFILER, // Profiler dump interval elapsed
+    TASK_COUNT
+};
+static Sched_t sched;
+
+// Pipeline stages timed with PROF_BEGIN/PROF_END, dumped every profilerMs
+enum {
+    STAGE_BLOCK,
+    STAGE_COPY,
+    STAGE_DECIMATE,
+    STAGE_STACK,
+    STAGE_RECORD_TX,
+    STAGE_FILTER,
+    STAGE_BUZZER,
+    STAGE_DECAY_FIT,
+    STAGE_PULSE_TX,
+    STAGE_OLED_DRAW,
+    STAGE_OLED_FLUSH,
+    STAGE_COMMAND,
+    STAGE_COUNT
+};
+#if PROFILER_ENABLED
+static Prof_Stage_t profStages[STAGE_COUNT] = {
+    [STAGE_BLOCK] = { .name = "block" },         // Process_Block, everything below but the OLED and commands
+    [STAGE_COPY] = { .name = "copy" },           // Get_Last_N_Samples
+    [STAGE_DECIMATE] = { .name = "decimate" },
+    [STAGE_STACK] = { .name = "stack" },         // Stack_Add, and Stack_Average when the stack is full
+    [STAGE_RECORD_TX] = { .name = "record_tx" }, // Telemetry_SendRecord
+    [STAGE_FILTER] = { .name = "filter" },       // Handle_Sample: EMAs, detector and buzzer
+    [STAGE_BUZZER] = { .name = "buzzer" },
+    [STAGE_DECAY_FIT] = { .name = "decay_fit" },
+    [STAGE_PULSE_TX] = { .name = "pulse_tx" },   // Telemetry_SendPulse
+    [STAGE_OLED_DRAW] = { .name = "oled_draw" },
+    [STAGE_OLED_FLUSH] = { .name = "oled_flush" },
+    [STAGE_COMMAND] = { .name = "command" },
+};
+static uint16_t profilerMs = PROFILER_DUMP_MS;
+static uint32_t profilerPostMs = 0;  // Owned by the pulse timer interrupt
+static uint32_t profilerResetMs = 0;
+_Static_assert(STAGE_COUNT <= TELEMETRY_MAX_STAGES, "the profiler dump holds TELEMETRY_MAX_STAGES");
+
+// bank_bench=1 times a read kernel over a buffer in each SRAM bank while the
+// ADC DMA writes value[] in SRAM2, run it with sync=0 for a continuous stream.
+// The cycles over the SRAM3 pass are the stalls a kernel pays when its data
+// shares the bank with the DMA, as everything did before the banks were split.
+#define BANK_BENCH_SAMPLES 512
+#define BANK_BENCH_RUNS 64
+static uint8_t bankBench = 0;
+static uint16_t benchSram1[BANK_BENCH_SAMPLES];
+DMA_BUFFER static uint16_t benchSram2[BANK_BENCH_SAMPLES];
+DSP_DATA static uint16_t benchSram3[BANK_BENCH_SAMPLES];
+volatile static uint32_t benchSink;
+#endif
+
+// The pulse timer posts TASK_DISPLAY every OLED_REFRESH_MS, the task redraws
+// if a pulse came in since. The changed spans go out one SSD1306_Flush slice
+// per run, and while some are left Task_Block posts the next run right after
+// a block, so the bit-banged bytes go out in the gap before the next one.
+#define OLED_REFRESH_MS 50
+static uint32_t oledLastMs = 0;
+static uint8_t oledFlushing = 0;
+static uint8_t oledStale = 0;
+static float oledTime = 0;
+static uint32_t oledLost = 0;
 static uint16_t stabilizedCounter = 0;
 
-volatile static uint16_t dmaIndex = 0;
 volatile static uint16_t timerIndex = 0;
 volatile static uint8_t outOfWindowTriggered = 1;
 
 #define DMA_BUFFER_ENTRIES 2048
+#define DMA_BLOCK_ENTRIES (DMA_BUFFER_ENTRIES / 2)
+#define AWD_LOW_THRESHOLD 2500
+#define AWD_HIGH_THRESHOLD 4095
+// AWD2 and AWD3 time two more points further down the decay. Their
+// thresholds are 8 bit, compared with the top 8 bits of the 12 bit result.
+#define AWD2_THRESHOLD 1792
+#define AWD3_THRESHOLD 1408
+#define PULSE_TICK_NS 20
+// Hard limits on the transmit pulse, whatever the command channel asks for.
+// 200 us is one L/R time constant of the 400 uH, 2 Ohm coil on 7.4 V: about
+// 2.3 A, well inside the IRF740. The off time leaves the coil current and the
+// decay window to settle before the next pulse.
+#define PULSE_WIDTH_MAX_TICKS 10000
+#define PULSE_OFF_MIN_TICKS 5000
+
+// Pulse-synchronous mode: TIM1 OC4REF (TRGO2) starts a burst of up to
+// BURST_SAMPLES conversions burstDelayTicks after the CH3 transmit pulse ends
+#define BURST_SAMPLES 512
+// The burst has to be over this long before the next period starts, time
+// for the completion callback to re-arm the DMA
+#define BURST_MARGIN_TICKS 250
+
+// Window before the crossing handed to the decay fit
+#define HISTORY_US 10
+#define HISTORY_MAX DECAY_MAX_SAMPLES
+// End of a burst record used as the decay baseline
+#define BASELINE_SAMPLES 32
+// Free-running baseline window ends this many DMA samples before the period
+// start, covers the head and timer reads not being simultaneous
+#define BASELINE_GUARD_SAMPLES 8
+
+typedef struct {
+    uint32_t samplingTime;       // ADC_SAMPLETIME_x
+    uint16_t samplingHalfCycles; // The same sampling time in half ADC clock cycles
+    uint8_t ratioLog2;           // Hardware oversampling ratio 2^n, 0 = oversampler off
+    uint8_t extraBits;           // Bits kept above 12 after the oversampler shift, pulse-sync only
+    uint8_t decimation;          // Software boxcar decimation of the DMA samples
+    uint8_t interleaved;         // ADC1 + ADC2 interleaved on PA0, twice the conversion rate
+} Acq_Profile_t;
+
+static const Acq_Profile_t acqProfiles[] = {
+    { ADC_SAMPLETIME_2CYCLES_5, 5, 0, 0, 1, 0 }, // 4.17 MS/s, 12 bit
+    { ADC_SAMPLETIME_2CYCLES_5, 5, 2, 1, 1, 0 }, // 1.04 MS/s, 13 bit
+    { ADC_SAMPLETIME_2CYCLES_5, 5, 4, 2, 1, 0 }, // 260 kS/s, 14 bit
+    { ADC_SAMPLETIME_6CYCLES_5, 13, 2, 0, 2, 0 }, // 411 kS/s, 12 bit, longer sampling for high impedance
+    { ADC_SAMPLETIME_2CYCLES_5, 5, 0, 0, 1, 1 }, // 8.33 MS/s, 12 bit, dual ADC for the early decay
+};
+#define ACQ_PROFILE_COUNT (sizeof(acqProfiles) / sizeof(acqProfiles[0]))
+
+// Derived from the active profile by Acquisition_Start
+static uint8_t acqProfile = 0;
+static uint32_t sampleRateHz = 4166667;
+static uint32_t dmaRateHz = 4166667; // Before decimation
+static uint8_t sampleBits = 12;
+static uint16_t historyLen = 42;
+static uint16_t burstSamples = BURST_SAMPLES; // DMA samples per burst, fitted to the period
+static uint16_t recordLen = BURST_SAMPLES;
+static uint8_t interleaved = 0;
+
+DMA_BUFFER __attribute__((aligned(32))) volatile static uint16_t value[DMA_BUFFER_ENTRIES];
+
+// Completed DMA blocks, block n lives in half (n & 1) of value[].
+// Posted from the half/full transfer callbacks, consumed by GitKop_Loop.
+volatile static uint32_t blocksPosted = 0;
+static uint32_t blocksProcessed = 0;
+static uint32_t blocksDropped = 0;
 
-__attribute__((aligned(32))) volatile static uint16_t value[DMA_BUFFER_ENTRIES];
+// AWD crossing of the current pulse: DMA write position and the block it falls in
+volatile static uint16_t crossingHead = 0;
+volatile static uint32_t crossingBlock = 0;
+volatile static uint8_t crossingPending = 0;
+static uint32_t pulsesDropped = 0;
 
-float detectionThreshold = 5;
+// TIM1 count at the fall through each watchdog level, per period, 0 until
+// it happens, and the DMA write position read just before it. Free-running
+// only, pulse-sync reads the levels off the record.
+#define CROSSING_PERIODS 4
+volatile static uint16_t crossingTicks[CROSSING_PERIODS][DECAY_LEVELS];
+volatile static uint16_t crossingHeads[CROSSING_PERIODS][DECAY_LEVELS];
+static uint16_t crossingLevels[DECAY_LEVELS] = { AWD_LOW_THRESHOLD, AWD2_THRESHOLD, AWD3_THRESHOLD };
+// DMA samples before an AWD2 or AWD3 latch searched for its crossing, more
+// than the watchdog interrupt ever waits behind the DMA
+#define CROSSING_WINDOW 32
+static uint32_t awdConversionNs = 200; // From holding the input to the result the watchdogs see
+static Decay_Crossings_t decayCrossings;
+
+// Every TIM1 period is one pulse, numbered by the update interrupt. The number
+// travels with the crossing (free-running) or the burst half (pulse-sync), so
+// a processed pulse knows which period it came from and gaps are visible.
+volatile static uint32_t pulseCount = 0;
+volatile static uint32_t crossingPulse = 0;
+volatile static uint32_t blockPulse[2];
+static uint32_t pulseSequence = 0;        // Period of the pulse being processed
+volatile static uint32_t pulsesMissed = 0;      // Periods without a crossing
+volatile static uint32_t pulsesOverwritten = 0; // Crossings or bursts replaced before they were processed
+volatile static uint32_t adcOverruns = 0;       // ADC_OVR: a conversion was lost before the DMA read it
+
+static uint32_t blockCycles = 0;
+static uint32_t blockCyclesMax = 0;
+static uint32_t blockCycleBudget = 0;
+// DWT time the DMA finished each half, latency runs from there to the end of processing
+volatile static uint32_t blockPostedAt[2];
+static uint32_t blockLatency = 0;
+static uint32_t blockLatencyMax = 0;
+
+static uint8_t pulseSync = 0;
+static uint16_t burstDelayTicks = 0;
+
+// Coherent averaging of pulse-sync bursts, recordDepth is the number of
+// pulses behind every record that reaches Process_Pulse
+DSP_DATA static Stack_t stack;
+static uint16_t stackDepth = 1;
+static uint16_t recordDepth = 1;
+DSP_DATA static uint16_t stackedRecord[BURST_SAMPLES];
+
+// Level the decay settles to, measured on the tail of every burst record.
+// Free-running captures end at the crossing and take it from the end of the
+// previous period, still in the ring ahead of the transmit pulse.
+static uint16_t decayBaseline = 0;
+static Decay_Fit_t decayFit;
+
+// streamMode: raw burst records, Rice coded, falls back to plain samples
+// when a noisy record would not shrink. USART1 moves 200 kB/s (2 Mbaud, 8N1),
+// about 200 bytes per pulse period, and a 512 sample record is about 500 bytes
+// coded and 1 kB plain, so only one burst in streamEvery is sent. It is worked
+// out for plain records in three quarters of the UART, the rest is left to
+// the pulse frames and replies, so the stream does not drop records.
+#define STREAM_UART_BYTES_PER_S 200000
+static uint8_t streamEvery = 1;
+static uint8_t streamCount = 0;
+_Static_assert(BURST_SAMPLES <= TELEMETRY_MAX_RECORD, "a burst record has to fit a record frame");
+
+// Alarm at detectKOn sigmas of the running noise on fast - slow,
+// released at detectKOff, see DETECT_NOISE_ALPHA in GitKop.h
+// Alarm pitch: BUZZ_BASE_HZ for the smallest shift, BUZZ_HZ_PER_US higher per
+// microsecond of it. The shift runs from tens of ns to about 20 us.
+#define BUZZ_BASE_HZ 400
+#define BUZZ_HZ_PER_US 100
+#define BUZZ_MAX_HZ 4000
+Detector_t detector;
 EMA_t slowFilter;
 EMA_t fastFilter;
 
 uint8_t test = 0;
 uint8_t emaSetUp = 0;
 
-int _write(int file, char* ptr, int len) {
-    HAL_UART_Transmit(&UART, (uint8_t*) ptr, len, HAL_MAX_DELAY);
-    return len;
+// Tunable over the command channel, seeded from the GitKop.h defaults.
+// Only the main loop reads them, so a set between two blocks is atomic.
+static uint8_t debugMode = DEBUG_MODE;
+static uint8_t streamMode = STREAM_MODE;
+static uint8_t buzzerEnabled = ENABLE_BUZZER;
+static float slowAlpha = SLOW_ALPHA;
+static float fastAlpha = FAST_ALPHA;
+static float detectKOn = DETECT_K_ON;
+static float detectKOff = DETECT_K_OFF;
+static uint16_t pulseWidth = 0;  // TIM1 CCR3, read back from tim.c in GitKop_Init
+static uint16_t pulsePeriod = 0; // TIM1 ARR
+static uint16_t awdLow = AWD_LOW_THRESHOLD;
+static uint16_t awdHigh = AWD_HIGH_THRESHOLD;
+static uint16_t awd2Level = AWD2_THRESHOLD;
+static uint16_t awd3Level = AWD3_THRESHOLD;
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    Uart_TxCplt(huart);
+}
+
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+    Command_RxEvent(huart, Size);
+    Sched_Post(&sched, TASK_COMMAND);
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    Command_RxError(huart);
 }
 
 void Buzzer_Set(uint16_t freqHz)
 {
+    PROF_BEGIN(STAGE_BUZZER);
     if (freqHz == 0)
     {
         __HAL_TIM_SET_COMPARE(&BUZZ_TIMER, BUZZ_CHANNEL, 0);
-        return;
     }
+    else
+    {
+        uint32_t apb1 = HAL_RCC_GetPCLK1Freq();
+        uint32_t psc = BUZZ_TIMER.Instance->PSC;
 
-    uint32_t apb1 = HAL_RCC_GetPCLK1Freq();
-    uint32_t psc = BUZZ_TIMER.Instance->PSC;
+        // TIM12 is 16 bit, a lower pitch than that allows would wrap
+        uint32_t newAutoreload = (apb1 / ((psc + 1) * freqHz)) - 1;
+        if (newAutoreload > 0xFFFF)
+            newAutoreload = 0xFFFF;
 
-    uint32_t newAutoreload = (apb1 / ((psc + 1) * freqHz)) - 1;
+        __HAL_TIM_SET_AUTORELOAD(&BUZZ_TIMER, newAutoreload);
+        __HAL_TIM_SET_COMPARE(&BUZZ_TIMER, BUZZ_CHANNEL, newAutoreload / 2);
+    }
+    PROF_END(STAGE_BUZZER);
+}
 
-    __HAL_TIM_SET_AUTORELOAD(&BUZZ_TIMER, newAutoreload);
-    __HAL_TIM_SET_COMPARE(&BUZZ_TIMER, BUZZ_CHANNEL, newAutoreload / 2);
+// Alpha giving the same time constant when the filter sees one update per
+// recordDepth pulses: 1 - (1 - alpha)^N
+float Scale_Alpha(float alpha)
+{
+    if (recordDepth <= 1)
+        return alpha;
+    return 1.0f - powf(1.0f - alpha, recordDepth);
 }
 
-float Handle_Sample(uint16_t rawSample)
+// x: crossing time in microseconds, Q15.16
+RAMFUNC float Handle_Sample(int32_t x)
 {
-    float x = rawSample;
     if (!emaSetUp)
     {
-        EMA_Init(&slowFilter, 0.0005, x);
-        EMA_Init(&fastFilter, 0.1, x);
+        EMA_Init(&slowFilter, Filt_Q31(Scale_Alpha(slowAlpha)), x);
+        EMA_Init(&fastFilter, Filt_Q31(Scale_Alpha(fastAlpha)), x);
+        Detector_Init(&detector, Filt_Q31(Scale_Alpha(DETECT_NOISE_ALPHA)), FILT_FROM_FLOAT(detectKOn),
+            FILT_FROM_FLOAT(detectKOff), FILT_FROM_FLOAT(DETECT_SIGMA_MIN_US), recordDepth);
         emaSetUp = 1;
     }
     else
     {
-        EMA_Update(&fastFilter, rawSample);
-        EMA_Update(&slowFilter, rawSample);
+        EMA_Update(&fastFilter, x);
+        EMA_Update(&slowFilter, x);
     }
 
-    float difference = fastFilter.out - slowFilter.out;
+    int32_t difference = fastFilter.out - slowFilter.out;
 
-    if (difference < detectionThreshold)
+    if (!Detector_Update(&detector, difference))
     {
         Buzzer_Set(0);
     }
     else
     {
-        float hz = difference;
-        if (ENABLE_BUZZER)
-            Buzzer_Set(hz);
+        uint32_t shift = difference < 0 ? -(uint32_t) difference : (uint32_t) difference;
+        uint32_t hz = BUZZ_BASE_HZ + (uint32_t) (((uint64_t) shift * BUZZ_HZ_PER_US) >> FILT_Q);
+        if (hz > BUZZ_MAX_HZ)
+            hz = BUZZ_MAX_HZ;
+        if (buzzerEnabled)
+            Buzzer_Set((uint16_t) hz);
+    }
+    return FILT_TO_FLOAT(difference);
+}
+
+void Param_Buzzer()
+{
+    if (!buzzerEnabled)
+        Buzzer_Set(0);
+}
+
+// Re-seed the filters and the detector with the new alphas and levels
+void Param_Filters()
+{
+    emaSetUp = 0;
+}
+
+// CCR3, CCR4 and (with ARPE set) ARR are preloaded, so the new timing starts
+// with the next period and no pulse is cut short
+void Param_Timer()
+{
+    if (pulseWidth > PULSE_WIDTH_MAX_TICKS)
+        pulseWidth = PULSE_WIDTH_MAX_TICKS;
+    if (pulsePeriod + 1 - pulseWidth < PULSE_OFF_MIN_TICKS)
+        pulseWidth = pulsePeriod + 1 - PULSE_OFF_MIN_TICKS;
+    if (burstDelayTicks > pulsePeriod - 2)
+        burstDelayTicks = pulsePeriod - 2;
+    if (pulseWidth + burstDelayTicks >= pulsePeriod)
+        pulseWidth = pulsePeriod - burstDelayTicks - 1;
+
+    PULSE_TIMER.Instance->CR1 |= TIM_CR1_ARPE;
+    __HAL_TIM_SET_AUTORELOAD(&PULSE_TIMER, pulsePeriod);
+    __HAL_TIM_SET_COMPARE(&PULSE_TIMER, TIM_CHANNEL_3, pulseWidth);
+    Acquisition_SetBurstDelay(burstDelayTicks);
+
+    // The burst length follows the time left after the pulse and the delay
+    if (pulseSync)
+        Acquisition_Start(1);
+}
+
+// The thresholds can be written while the ADC converts
+void Param_Awd()
+{
+    if (awdLow > awdHigh)
+        awdLow = awdHigh;
+    LL_ADC_ConfigAnalogWDThresholds(ADC.Instance, LL_ADC_AWD1, awdHigh, awdLow);
+    // The LL call takes AWD2 and AWD3 thresholds in their 8 bit register form
+    LL_ADC_ConfigAnalogWDThresholds(ADC.Instance, LL_ADC_AWD2, awdHigh >> 4, awd2Level >> 4);
+    LL_ADC_ConfigAnalogWDThresholds(ADC.Instance, LL_ADC_AWD3, awdHigh >> 4, awd3Level >> 4);
+
+    // The levels as the watchdogs apply them
+    crossingLevels[0] = awdLow;
+    crossingLevels[1] = awd2Level & ~0xF;
+    crossingLevels[2] = awd3Level & ~0xF;
+}
+
+void Param_Acquisition()
+{
+    Acquisition_Start(pulseSync);
+}
+
+void Param_Stack()
+{
+    Stacking_SetDepth(stackDepth);
+}
+
+#if PROFILER_ENABLED
+// A new interval starts with clean counters
+void Param_Profiler()
+{
+    for (uint8_t i = 0; i < STAGE_COUNT; i++)
+        Prof_Reset(&profStages[i]);
+    profilerResetMs = HAL_GetTick();
+}
+
+// One load and add per sample, the access pattern of Stack_Add and Decimate
+__attribute__((noinline)) uint32_t Bank_BenchKernel(const uint16_t* samples)
+{
+    uint32_t sum = 0;
+    for (uint16_t i = 0; i < BANK_BENCH_SAMPLES; i++)
+        sum += samples[i];
+    return sum;
+}
+
+// Min and mean cycles of a kernel pass, interrupts masked so only the DMA competes
+void Bank_BenchRun(const uint16_t* samples, uint32_t* min, uint32_t* mean)
+{
+    uint32_t sum = 0;
+    *min = UINT32_MAX;
+    for (uint8_t run = 0; run < BANK_BENCH_RUNS; run++)
+    {
+        __disable_irq();
+        uint32_t start = DWT->CYCCNT;
+        benchSink = Bank_BenchKernel(samples);
+        uint32_t cycles = DWT->CYCCNT - start;
+        __enable_irq();
+
+        sum += cycles;
+        if (cycles < *min)
+            *min = cycles;
     }
-    return difference;
+    *mean = sum / BANK_BENCH_RUNS;
 }
 
+void Param_BankBench()
+{
+    if (!bankBench)
+        return;
+    bankBench = 0;
+
+    uint32_t min[3], mean[3];
+    Bank_BenchRun(benchSram1, &min[0], &mean[0]);
+    Bank_BenchRun(benchSram2, &min[1], &mean[1]);
+    Bank_BenchRun(benchSram3, &min[2], &mean[2]);
+
+    // A text line ends with 0x00 like the command replies
+    char line[128];
+    int len = snprintf(line, sizeof(line) - 1,
+                       "BENCH %u reads, cycles min/mean: SRAM1 %lu/%lu SRAM2 %lu/%lu SRAM3 %lu/%lu, DMA bank stalls %ld\r\n",
+                       BANK_BENCH_SAMPLES, min[0], mean[0], min[1], mean[1], min[2], mean[2],
+                       (int32_t) (mean[1] - mean[2]));
+    if (len < 0)
+        return;
+    if (len > (int) sizeof(line) - 2)
+        len = sizeof(line) - 2;
+    _write(1, line, len + 1);
+}
+#endif
+
+static const Param_t params[] = {
+    { "debug", PARAM_U8, &debugMode, 0, 1, NULL },
+    { "stream", PARAM_U8, &streamMode, 0, 1, NULL },
+    { "buzzer", PARAM_U8, &buzzerEnabled, 0, 1, Param_Buzzer },
+    { "alpha_slow", PARAM_FLOAT, &slowAlpha, 0, 1, Param_Filters },
+    { "alpha_fast", PARAM_FLOAT, &fastAlpha, 0, 1, Param_Filters },
+    { "k_on", PARAM_FLOAT, &detectKOn, 0.5f, 100, Param_Filters },
+    { "k_off", PARAM_FLOAT, &detectKOff, 0, 100, Param_Filters },
+    { "pulse_width", PARAM_U16, &pulseWidth, 1, PULSE_WIDTH_MAX_TICKS, Param_Timer },   // TIM1 ticks, 20 ns
+    { "period", PARAM_U16, &pulsePeriod, 10000, 65535, Param_Timer },
+    { "burst_delay", PARAM_U16, &burstDelayTicks, 0, 65535, Param_Timer },
+    { "awd_low", PARAM_U16, &awdLow, 0, 4095, Param_Awd },
+    { "awd_high", PARAM_U16, &awdHigh, 0, 4095, Param_Awd },
+    { "awd2", PARAM_U16, &awd2Level, 0, 4095, Param_Awd },
+    { "awd3", PARAM_U16, &awd3Level, 0, 4095, Param_Awd },
+    { "profile", PARAM_U8, &acqProfile, 0, ACQ_PROFILE_COUNT - 1, Param_Acquisition },
+    { "sync", PARAM_U8, &pulseSync, 0, 1, Param_Acquisition },
+    { "stack", PARAM_U16, &stackDepth, 1, STACK_MAX_DEPTH, Param_Stack },
+#if PROFILER_ENABLED
+    { "prof_ms", PARAM_U16, &profilerMs, 0, 60000, Param_Profiler },   // Profiler dump interval, 0 = off
+    { "bank_bench", PARAM_U8, &bankBench, 0, 1, Param_BankBench },       // 1 runs the SRAM bank benchmark once
+#endif
+};
+#define PARAM_COUNT (sizeof(params) / sizeof(params[0]))
+
 void GitKop_Init()
 {
-    printf("GitKop build %s %s\r\nCreated by Pawel Reich, https://gitmanik.dev\r\n", __TIME__, __DATE__);
+    // A text line ends with 0x00 like the command replies, or the plotter
+    // takes it as the start of the first frame
+    char banner[96];
+    int len = snprintf(banner, sizeof(banner) - 1, "GitKop build %s %s\r\nCreated by Pawel Reich, https://gitmanik.dev\r\n",
+                       __TIME__, __DATE__);
+    if (len > (int) sizeof(banner) - 2)
+        len = sizeof(banner) - 2;
+    if (len > 0)
+        _write(1, banner, len + 1);
 
     HAL_TIM_PWM_Start(&PULSE_TIMER, TIM_CHANNEL_3);
     HAL_TIM_Base_Start_IT(&PULSE_TIMER);
@@ -94,7 +511,24 @@ void GitKop_Init()
     HAL_TIM_PWM_Start(&BUZZ_TIMER, BUZZ_CHANNEL);
     Buzzer_Set(0);
 
-    HAL_ADC_Start_DMA(&ADC, (uint32_t*)value, DMA_BUFFER_ENTRIES);
+    // Cycle counter for per-block processing cost
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    Telemetry_CrcInit();
+#if PROFILER_ENABLED
+    Param_Profiler();
+#endif
+
+    pulseWidth = __HAL_TIM_GET_COMPARE(&PULSE_TIMER, TIM_CHANNEL_3);
+    pulsePeriod = __HAL_TIM_GET_AUTORELOAD(&PULSE_TIMER);
+    Uart_Init(&UART);
+    Command_Init(&UART, params, PARAM_COUNT);
+
+    acqProfile = ACQ_PROFILE;
+    Acquisition_Start(PULSE_SYNC_MODE);
+    Stacking_SetDepth(STACK_DEPTH);
     HAL_ADC_Start_IT(&ADC);
     HAL_GPIO_WritePin(USER_LED_GPIO_Port, USER_LED_Pin, 0);
 
@@ -109,31 +543,400 @@ void GitKop_Init()
     }
 }
 
+void Stacking_SetDepth(uint16_t depth)
+{
+    Stack_Init(&stack, recordLen, depth);
+    stackDepth = stack.depth;
+    recordDepth = pulseSync ? stackDepth : 1;
+    // Re-seed the filters with alphas matching the new update rate
+    emaSetUp = 0;
+}
+
+void Acquisition_SetBurstDelay(uint16_t ticks)
+{
+    burstDelayTicks = ticks;
+    // CCR4 is preloaded, the new delay takes effect from the next pulse
+    __HAL_TIM_SET_COMPARE(&PULSE_TIMER, TIM_CHANNEL_4, __HAL_TIM_GET_COMPARE(&PULSE_TIMER, TIM_CHANNEL_3) + ticks);
+}
+
+uint16_t Calculate_N(uint16_t us)
+{
+    return (uint16_t) (((uint64_t) us * sampleRateHz + 500000) / 1000000);
+}
+
+void Acquisition_SetProfile(uint8_t profile)
+{
+    if (profile >= ACQ_PROFILE_COUNT)
+        return;
+
+    acqProfile = profile;
+    Acquisition_Start(pulseSync);
+}
+
+// Rebuild the DMA node: half words from ADC1 DR, or in interleaved mode one
+// word per ADC1 + ADC2 pair from the common data register
+void Acquisition_ConfigDma(uint8_t packed, uint8_t circular)
+{
+    DMA_NodeConfTypeDef NodeConfig = {0};
+    NodeConfig.NodeType = DMA_GPDMA_LINEAR_NODE;
+    NodeConfig.Init.Request = GPDMA1_REQUEST_ADC1;
+    NodeConfig.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+    NodeConfig.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    NodeConfig.Init.SrcInc = DMA_SINC_FIXED;
+    NodeConfig.Init.DestInc = DMA_DINC_INCREMENTED;
+    NodeConfig.Init.SrcDataWidth = packed ? DMA_SRC_DATAWIDTH_WORD : DMA_SRC_DATAWIDTH_HALFWORD;
+    NodeConfig.Init.DestDataWidth = packed ? DMA_DEST_DATAWIDTH_WORD : DMA_DEST_DATAWIDTH_HALFWORD;
+    NodeConfig.Init.SrcBurstLength = 1;
+    NodeConfig.Init.DestBurstLength = 1;
+    NodeConfig.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+    NodeConfig.Init.TransferEventMode = DMA_TCEM_LAST_LL_ITEM_TRANSFER;
+    NodeConfig.Init.Mode = DMA_NORMAL;
+    NodeConfig.TriggerConfig.TriggerPolarity = DMA_TRIG_POLARITY_MASKED;
+    NodeConfig.DataHandlingConfig.DataExchange = DMA_EXCHANGE_NONE;
+    NodeConfig.DataHandlingConfig.DataAlignment = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+
+    HAL_DMAEx_List_UnLinkQ(ADC.DMA_Handle);
+    if (HAL_DMAEx_List_ResetQ(&List_GPDMA1_Channel5) != HAL_OK ||
+        HAL_DMAEx_List_BuildNode(&NodeConfig, &Node_GPDMA1_Channel5) != HAL_OK ||
+        HAL_DMAEx_List_InsertNode(&List_GPDMA1_Channel5, NULL, &Node_GPDMA1_Channel5) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    if (circular && HAL_DMAEx_List_SetCircularMode(&List_GPDMA1_Channel5) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    if (HAL_DMAEx_List_LinkQ(ADC.DMA_Handle, &List_GPDMA1_Channel5) != HAL_OK)
+    {
+        Error_Handler();
+    }
+}
+
+// Start samples conversions into buffer. The packed ADC1 + ADC2 words land
+// as master, slave half words, so buffer stays in time order either way.
+// HAL_ADC_ConvCpltCallback re-arms every burst through here.
+RAMFUNC void Acquisition_StartDma(volatile uint16_t* buffer, uint16_t samples)
+{
+    if (interleaved)
+        HAL_ADCEx_MultiModeStart_DMA(&ADC, (uint32_t*) buffer, samples / 2);
+    else
+        HAL_ADC_Start_DMA(&ADC, (uint32_t*) buffer, samples);
+}
+
+void Acquisition_Start(uint8_t sync)
+{
+    if (interleaved)
+        HAL_ADCEx_MultiModeStop_DMA(&ADC);
+    else
+        HAL_ADC_Stop_DMA(&ADC);
+
+    // The AWD thresholds are 12 bit, extra resolution is only kept for bursts
+    const Acq_Profile_t *profile = &acqProfiles[acqProfile];
+    uint8_t extraBits = sync ? profile->extraBits : 0;
+
+    // OC4REF goes high burstDelayTicks after the CH3 pulse falls and is routed to TRGO2
+    TIM_OC_InitTypeDef sConfigOC = {0};
+    sConfigOC.OCMode = TIM_OCMODE_PWM2;
+    sConfigOC.Pulse = __HAL_TIM_GET_COMPARE(&PULSE_TIMER, TIM_CHANNEL_3) + burstDelayTicks;
+    sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+    sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+    if (HAL_TIM_PWM_ConfigChannel(&PULSE_TIMER, &sConfigOC, TIM_CHANNEL_4) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    TIM_MasterConfigTypeDef sMasterConfig = {0};
+    sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+    sMasterConfig.MasterOutputTrigger2 = sync ? TIM_TRGO2_OC4REF : TIM_TRGO2_RESET;
+    sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+    if (HAL_TIMEx_MasterConfigSynchronization(&PULSE_TIMER, &sMasterConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    // In one-shot DMA mode the ADC stops converting once the burst is transferred
+    // and idles until the next trigger
+    ADC.Init.ExternalTrigConv = sync ? ADC_EXTERNALTRIG_T1_TRGO2 : ADC_SOFTWARE_START;
+    ADC.Init.ExternalTrigConvEdge = sync ? ADC_EXTERNALTRIGCONVEDGE_RISING : ADC_EXTERNALTRIGCONVEDGE_NONE;
+    ADC.Init.DMAContinuousRequests = sync ? DISABLE : ENABLE;
+    // Register encodings: ADC_OVERSAMPLING_RATIO_2 is 0, ADC_RIGHTBITSHIFT_n is n
+    ADC.Init.OversamplingMode = profile->ratioLog2 ? ENABLE : DISABLE;
+    ADC.Init.Oversampling.Ratio = profile->ratioLog2 ? (uint32_t) (profile->ratioLog2 - 1) << ADC_CFGR2_OVSR_Pos : 0;
+    ADC.Init.Oversampling.RightBitShift = (uint32_t) (profile->ratioLog2 - extraBits) << ADC_CFGR2_OVSS_Pos;
+    ADC.Init.Oversampling.TriggeredMode = ADC_TRIGGEREDMODE_SINGLE_TRIGGER;
+    ADC.Init.Oversampling.OversamplingStopReset = ADC_REGOVERSAMPLING_CONTINUED_MODE;
+    if (HAL_ADC_Init(&ADC) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    ADC_ChannelConfTypeDef sConfig = {0};
+    sConfig.Channel = ADC_CHANNEL_0;
+    sConfig.Rank = ADC_REGULAR_RANK_1;
+    sConfig.SamplingTime = profile->samplingTime;
+    sConfig.SingleDiff = ADC_SINGLE_ENDED;
+    sConfig.OffsetNumber = ADC_OFFSET_NONE;
+    sConfig.Offset = 0;
+    if (HAL_ADC_ConfigChannel(&ADC, &sConfig) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    // The slave follows the master trigger and starts converting TwoSamplingDelay
+    // after it, 7 of the 15 cycle conversion puts it about half way between two
+    // master samples. AWD1 only watches the master samples.
+    if (profile->interleaved)
+    {
+        ADC_SLAVE.Instance = ADC2;
+        ADC_SLAVE.Init = ADC.Init;
+        ADC_SLAVE.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+        ADC_SLAVE.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
+        if (HAL_ADC_Init(&ADC_SLAVE) != HAL_OK)
+        {
+            Error_Handler();
+        }
+        if (HAL_ADC_ConfigChannel(&ADC_SLAVE, &sConfig) != HAL_OK)
+        {
+            Error_Handler();
+        }
+    }
+
+    ADC_MultiModeTypeDef multimode = {0};
+    multimode.Mode = profile->interleaved ? ADC_DUALMODE_INTERL : ADC_MODE_INDEPENDENT;
+    multimode.DMAAccessMode = profile->interleaved ? ADC_DMAACCESSMODE_12_10_BITS : ADC_DMAACCESSMODE_DISABLED;
+    multimode.TwoSamplingDelay = ADC_TWOSAMPLINGDELAY_7CYCLES;
+    if (HAL_ADCEx_MultiModeConfigChannel(&ADC, &multimode) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    // ADC kernel clock is HCLK / 4 (ADC_CLOCK_ASYNC_DIV4), a 12 bit conversion
+    // takes the sampling time plus 12.5 cycles
+    uint32_t adcClock = HAL_RCC_GetHCLKFreq() / 4;
+    uint32_t dmaRate = (uint32_t) (((uint64_t) adcClock * 2) / ((uint32_t) (profile->samplingHalfCycles + 25) << profile->ratioLog2));
+    dmaRate <<= profile->interleaved;
+    sampleRateHz = dmaRate / profile->decimation;
+    dmaRateHz = dmaRate;
+    sampleBits = 12 + extraBits;
+
+    // A result is ready 12.5 cycles after its last input is held, and an
+    // oversampled one stands for the middle of its conversions
+    uint32_t conversionNs = (uint32_t) ((1000000000ull * (profile->samplingHalfCycles + 25)) / (2ull * adcClock));
+    awdConversionNs = (uint32_t) (12500000000ull / adcClock) + (((1u << profile->ratioLog2) - 1) * conversionNs) / 2;
+
+    historyLen = Calculate_N(HISTORY_US);
+    if (historyLen < 2)
+        historyLen = 2;
+    if (historyLen * profile->decimation > HISTORY_MAX)
+        historyLen = HISTORY_MAX / profile->decimation;
+
+    // Slow profiles cannot fill BURST_SAMPLES between the trigger and the
+    // next period, a longer burst would swallow every other trigger. Whole
+    // decimated samples, and sample pairs for the dual ADC.
+    uint32_t burstTicks = pulsePeriod + 1 - pulseWidth - burstDelayTicks;
+    burstTicks = burstTicks > BURST_MARGIN_TICKS ? burstTicks - BURST_MARGIN_TICKS : 0;
+    uint32_t fit = (uint32_t) (((uint64_t) burstTicks * PULSE_TICK_NS * dmaRate) / 1000000000u);
+    uint16_t step = profile->decimation << profile->interleaved;
+    uint16_t minimum = (historyLen + BASELINE_SAMPLES) * profile->decimation;
+    if (fit > BURST_SAMPLES)
+        fit = BURST_SAMPLES;
+    if (fit < minimum)
+        fit = minimum;
+    burstSamples = (uint16_t) (fit / step * step);
+    recordLen = burstSamples / profile->decimation;
+
+    // Record stream decimation, see streamEvery
+    uint32_t recordBytes = TELEMETRY_COBS_MAX(sizeof(Telemetry_Record_t) + burstSamples * 2 + 4) + 1;
+    uint32_t periodBytes = (uint32_t) (((uint64_t) (pulsePeriod + 1) * PULSE_TICK_NS * STREAM_UART_BYTES_PER_S) / 1000000000u);
+    periodBytes = periodBytes * 3 / 4;
+    uint32_t every = periodBytes ? (recordBytes + periodBytes - 1) / periodBytes : 255;
+    streamEvery = every > 255 ? 255 : every;
+    streamCount = 0;
+
+    // A burst block has the whole pulse period, a free-running block the time the DMA takes to fill it
+    if (sync)
+        blockCycleBudget = (PULSE_TIMER.Instance->PSC + 1) * (PULSE_TIMER.Instance->ARR + 1);
+    else
+        blockCycleBudget = (uint32_t) (((uint64_t) SystemCoreClock * DMA_BLOCK_ENTRIES) / dmaRate);
+
+    Acquisition_ConfigDma(profile->interleaved, !sync);
+
+    // Burst timing is recovered from the record itself, the AWD is only
+    // needed to locate the pulse in the free-running ring. CC3, the end of
+    // the transmit pulse, arms AWD2 and AWD3 for the decay.
+    if (sync)
+    {
+        __HAL_ADC_DISABLE_IT(&ADC, ADC_IT_AWD1 | ADC_IT_AWD2 | ADC_IT_AWD3);
+        __HAL_TIM_DISABLE_IT(&PULSE_TIMER, TIM_IT_CC3);
+    }
+    else
+    {
+        __HAL_ADC_ENABLE_IT(&ADC, ADC_IT_AWD1);
+        __HAL_TIM_CLEAR_IT(&PULSE_TIMER, TIM_IT_CC3);
+        __HAL_TIM_ENABLE_IT(&PULSE_TIMER, TIM_IT_CC3);
+    }
+
+    pulseSync = sync;
+    recordDepth = pulseSync ? stackDepth : 1;
+    emaSetUp = 0;
+    Stack_Init(&stack, recordLen, stackDepth);
+    blocksPosted = 0;
+    blocksProcessed = 0;
+    crossingPending = 0;
+    interleaved = profile->interleaved;
+    // The baseline is on the scale of the previous profile
+    decayBaseline = 0;
+
+    Acquisition_StartDma(value, sync ? burstSamples : DMA_BUFFER_ENTRIES);
+}
+
 
-void HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef *hadc)
+RAMFUNC void HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef *hadc)
 {
     if (outOfWindowTriggered)
         return;
 
-    dmaIndex = __HAL_DMA_GET_COUNTER(ADC.DMA_Handle) / 2;
-    timerIndex = __HAL_TIM_GET_COUNTER(&PULSE_TIMER);
+    // The timer right after the DMA position, the interrupt latency then
+    // moves both together and drops out of the interpolated crossing time
+    uint16_t head = DMA_BUFFER_ENTRIES - __HAL_DMA_GET_COUNTER(ADC.DMA_Handle) / 2;
+    uint16_t ticks = __HAL_TIM_GET_COUNTER(&PULSE_TIMER);
+    uint16_t lastWritten = (head + DMA_BUFFER_ENTRIES - 1) % DMA_BUFFER_ENTRIES;
+
+    // The DMA interrupt has lower priority, so the block holding the crossing
+    // may not be reflected in blocksPosted yet
+    uint32_t block = blocksPosted;
+    if ((block & 1) != lastWritten / DMA_BLOCK_ENTRIES)
+        block++;
+
+    // The main loop has not reached the previous crossing yet
+    if (crossingPending)
+        pulsesOverwritten++;
+
+    crossingHead = head;
+    crossingBlock = block;
+    crossingPulse = pulseCount;
+    timerIndex = ticks;
+    crossingHeads[pulseCount % CROSSING_PERIODS][0] = head;
+    crossingTicks[pulseCount % CROSSING_PERIODS][0] = timerIndex;
+    crossingPending = 1;
     outOfWindowTriggered = 1;
 }
 
-void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+// AWD2 and AWD3 only latch the DMA position and the timer, Process_Block
+// finds the crossing in the samples before that position. Each is armed at
+// the end of the transmit pulse and disarmed once it has its crossing, so it
+// costs one interrupt per pulse rather than one per sample below its level.
+RAMFUNC void Awd_Latch(uint8_t level, uint32_t it)
+{
+    uint8_t period = pulseCount % CROSSING_PERIODS;
+    crossingHeads[period][level] = DMA_BUFFER_ENTRIES - __HAL_DMA_GET_COUNTER(ADC.DMA_Handle) / 2;
+    crossingTicks[period][level] = __HAL_TIM_GET_COUNTER(&PULSE_TIMER);
+    __HAL_ADC_DISABLE_IT(&ADC, it);
+}
+
+RAMFUNC void HAL_ADCEx_LevelOutOfWindow2Callback(ADC_HandleTypeDef *hadc)
+{
+    Awd_Latch(1, ADC_IT_AWD2);
+}
+
+RAMFUNC void HAL_ADCEx_LevelOutOfWindow3Callback(ADC_HandleTypeDef *hadc)
+{
+    Awd_Latch(2, ADC_IT_AWD3);
+}
+
+// With DMA the HAL reports every overrun, the flag is cleared after this returns
+RAMFUNC void HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc)
+{
+    if (hadc->ErrorCode & HAL_ADC_ERROR_OVR)
+    {
+        adcOverruns++;
+        hadc->ErrorCode &= ~HAL_ADC_ERROR_OVR;
+    }
+}
+
+RAMFUNC void Block_Post()
+{
+    blockPostedAt[blocksPosted & 1] = DWT->CYCCNT;
+    blocksPosted++;
+    Sched_Post(&sched, TASK_BLOCK);
+}
+
+RAMFUNC void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if (pulseSync)
+        return;
+
+    Block_Post();
+}
+
+RAMFUNC void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    // Acquisition_Start sizes the burst to end inside the period its trigger came from
+    if (pulseSync)
+        blockPulse[blocksPosted & 1] = pulseCount;
+    Block_Post();
+
+    // Re-arm for the next trigger into the other half, so the finished burst
+    // stays intact while GitKop_Loop works on it
+    if (pulseSync)
+        Acquisition_StartDma(&value[(blocksPosted & 1) * DMA_BLOCK_ENTRIES], burstSamples);
+}
+
+RAMFUNC void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
     if (htim == &PULSE_TIMER)
     {
+        pulseCount++;
+
+        uint32_t now = HAL_GetTick();
+        if (now - oledLastMs >= OLED_REFRESH_MS)
+        {
+            oledLastMs = now;
+            Sched_Post(&sched, TASK_DISPLAY);
+        }
+#if PROFILER_ENABLED
+        if (profilerMs && now - profilerPostMs >= profilerMs)
+        {
+            profilerPostMs = now;
+            Sched_Post(&sched, TASK_PROFILER);
+        }
+#endif
+
         if (!test)
         {
             test = 1;
             return;
         }
+        // Still armed from the previous period: the AWD never fired
+        if (!pulseSync && !outOfWindowTriggered)
+            pulsesMissed++;
         outOfWindowTriggered = 0;
+
+        // A level the last decay never reached is still armed, and the
+        // previous tail stays below it until the flyback
+        if (!pulseSync)
+        {
+            volatile uint16_t* ticks = crossingTicks[pulseCount % CROSSING_PERIODS];
+            for (uint8_t i = 0; i < DECAY_LEVELS; i++)
+                ticks[i] = 0;
+            __HAL_ADC_DISABLE_IT(&ADC, ADC_IT_AWD2 | ADC_IT_AWD3);
+        }
     }
 }
 
-void Get_Last_N_Samples(uint16_t *buffer, uint16_t *output, uint16_t head_idx, uint16_t n_samples, uint16_t buf_len)
+RAMFUNC void HAL_TIM_PWM_PulseFinishedCallback(TIM_HandleTypeDef *htim)
+{
+    if (htim != &PULSE_TIMER || htim->Channel != HAL_TIM_ACTIVE_CHANNEL_3 || pulseSync)
+        return;
+
+    // The transmit pulse has ended and the input is above both levels. The
+    // flags are still set from every sample of the last decay below them and
+    // would fire as soon as the interrupts are enabled.
+    __HAL_ADC_CLEAR_FLAG(&ADC, ADC_FLAG_AWD2 | ADC_FLAG_AWD3);
+    __HAL_ADC_ENABLE_IT(&ADC, ADC_IT_AWD2 | ADC_IT_AWD3);
+}
+
+RAMFUNC void Get_Last_N_Samples(uint16_t *buffer, uint16_t *output, uint16_t head_idx, uint16_t n_samples, uint16_t buf_len)
 {
     int16_t start_idx = (head_idx - n_samples + buf_len) % buf_len;
 
@@ -149,66 +952,442 @@ void Get_Last_N_Samples(uint16_t *buffer, uint16_t *output, uint16_t head_idx, u
     }
 }
 
-float Calculate_Slope(uint16_t* buffer, size_t sz)
+// Boxcar average of every factor consecutive samples, in place
+RAMFUNC uint16_t Decimate(uint16_t* samples, uint16_t count, uint8_t factor)
 {
-    float delta_s = ((float) (buffer[sz-1] - buffer[0]));
-    float delta_v = delta_s * (3.3f / 4095.0f);
-    float delta_time = (sz - 1)/(4160000.f);
-    return delta_v / delta_time;
+    if (factor <= 1)
+        return count;
+
+    uint16_t out = count / factor;
+    for (uint16_t i = 0; i < out; i++)
+    {
+        uint32_t sum = 0;
+        for (uint8_t j = 0; j < factor; j++)
+            sum += samples[i * factor + j];
+        samples[i] = (uint16_t) ((sum + factor / 2) / factor);
+    }
+    return out;
 }
-#define CALCULATE_N(us)    ((((us) * 416) + 50) / 100)
 
-uint16_t enc_s = 0;
-void GitKop_Loop()
+// Index of the first sample below threshold after the flyback has been above it,
+// count if the record never crosses
+RAMFUNC uint16_t Find_Crossing(const uint16_t* record, uint16_t count, uint16_t threshold)
+{
+    uint16_t i = 0;
+    while (i < count && record[i] < threshold)
+        i++;
+    while (i < count && record[i] >= threshold)
+        i++;
+    return i;
+}
+
+// First index from start on with the record below threshold, count if none
+RAMFUNC uint16_t Find_Below(const uint16_t* record, uint16_t start, uint16_t count, uint16_t threshold)
+{
+    while (start < count && record[start] >= threshold)
+        start++;
+    return start;
+}
+
+// Crossing of a watchdog level in a free-running window, ns since the period
+// started, Q24.8. The window ends with the last sample the DMA had written
+// when the AWD callback read TIM1 as ticks, which ties its samples to the
+// timer: that sample was held awdConversionNs before its result was ready.
+// Neither the AWD filter delay nor the interrupt latency enters. 0 when the
+// window does not hold the crossing, the timer alone would carry the latency.
+uint32_t History_CrossingTime(const uint16_t* history, uint16_t count, uint8_t decimation, uint16_t level, uint16_t ticks)
+{
+    // Back from the end over the samples the watchdog saw below the level
+    uint16_t i = count - 1;
+    while (i > 0 && history[i] < level)
+        i--;
+    if (i == count - 1 || history[i] < level)
+        return 0;
+
+    uint16_t fraction = Decay_Interpolate(&history[i], count - i, level, 4095);
+    // DMA samples from the crossing to the end of the window, Q8: a decimated
+    // sample sits in the middle of the ones it averages
+    uint32_t backQ8 = (((uint32_t) (count - 1 - i) << 8) - fraction) * decimation + (decimation - 1) * 128;
+    uint32_t backNsQ8 = (uint32_t) (((uint64_t) backQ8 * 1000000000u) / dmaRateHz);
+    uint32_t endNsQ8 = ((uint32_t) ticks * PULSE_TICK_NS - awdConversionNs) << 8;
+    return endNsQ8 > backNsQ8 ? endNsQ8 - backNsQ8 : 0;
+}
+
+// Whether the back ring entries before head were still intact once they
+// were copied, call it after the copy. While the crossing block is
+// processed the DMA rewrites the other half from its start, so a read
+// reaching into that half holds as long as the write position has not got to
+// where the read starts. The write position only moves forward through the
+// half, so a check after the copy covers the copy as well.
+uint8_t Ring_Intact(uint16_t head, uint16_t back)
 {
-    if (dmaIndex != 0)
+    uint16_t blockStart = (crossingBlock & 1) * DMA_BLOCK_ENTRIES;
+    uint16_t write = (DMA_BUFFER_ENTRIES - __HAL_DMA_GET_COUNTER(ADC.DMA_Handle) / 2) % DMA_BUFFER_ENTRIES;
+
+    // The DMA has finished the other half too and is back in the crossing block
+    if (blocksPosted != crossingBlock + 1 || write / DMA_BLOCK_ENTRIES == (crossingBlock & 1))
+        return 0;
+
+    uint16_t inBlock = (head + DMA_BUFFER_ENTRIES - blockStart) % DMA_BUFFER_ENTRIES;
+    if (back <= inBlock)
+        return 1;
+    if (back > inBlock + DMA_BLOCK_ENTRIES)
+        return 0;
+    uint16_t start = (head + DMA_BUFFER_ENTRIES - back) % DMA_BUFFER_ENTRIES;
+    return write <= start;
+}
+
+// Free-running baseline, the average of BASELINE_SAMPLES decimated samples
+// before the transmit pulse of the period whose crossing is at head, ticks
+// into it. The previous value when that stretch is not intact any more.
+uint16_t Ring_Baseline(uint16_t head, uint16_t ticks, uint8_t decimation)
+{
+    uint32_t back = (uint32_t) (((uint64_t) ticks * PULSE_TICK_NS * dmaRateHz) / 1000000000u) + BASELINE_GUARD_SAMPLES;
+    uint16_t count = BASELINE_SAMPLES * decimation;
+    if (back + count > DMA_BUFFER_ENTRIES)
+        return decayBaseline;
+
+    uint16_t i = (head + 2 * DMA_BUFFER_ENTRIES - back - count) % DMA_BUFFER_ENTRIES;
+    uint32_t sum = 0;
+    for (uint16_t k = 0; k < count; k++)
+    {
+        sum += value[i];
+        if (++i >= DMA_BUFFER_ENTRIES)
+            i = 0;
+    }
+    if (!Ring_Intact(head, back + count))
+        return decayBaseline;
+    return (uint16_t) (sum / count);
+}
+
+// Skip the first pulses while the coil and front end settle
+uint8_t Pulse_Settled()
+{
+    if (stabilizedCounter < 1000)
     {
         stabilizedCounter++;
-        if (stabilizedCounter < 1000)
-        {
-            goto end;
-        }
+        return 0;
+    }
+    return 1;
+}
 
-        debugOutputCtr++;
-        updateOledCtr++;
-        #define HISTORY_LEN CALCULATE_N(10)
-        uint16_t linear_history[HISTORY_LEN];
+// Pulse frame with the state of the whole pipeline, see Telemetry_Pulse_t
+void Pulse_Report(const uint16_t* samples, uint16_t count, uint32_t timeNsQ8, float val)
+{
+    Telemetry_Pulse_t frame;
+    frame.time = timeNsQ8 / 256000.0f;
+    frame.timeNsQ8 = timeNsQ8;
+    frame.value = val;
+    frame.tau = decayFit.tauNs / 1000.0f;
+    frame.fast = fastFilter.out;
+    frame.slow = slowFilter.out;
+    frame.sigma = detector.sigma;
+    frame.threshold = detector.threshold;
+    frame.alarmRate = detector.rate.out;
+    frame.amplitude = decayFit.amplitude;
+    frame.residual = decayFit.residual;
+    frame.blockCycles = blockCycles;
+    frame.blockCyclesMax = blockCyclesMax;
+    frame.blockCycleBudget = blockCycleBudget;
+    frame.blockLatency = blockLatency;
+    frame.blockLatencyMax = blockLatencyMax;
+    frame.blocksDropped = blocksDropped;
+    frame.pulsesDropped = pulsesDropped;
+    frame.pulseSequence = pulseSequence;
+    frame.pulsesMissed = pulsesMissed;
+    frame.pulsesOverwritten = pulsesOverwritten;
+    frame.adcOverruns = adcOverruns;
+    for (uint8_t i = 0; i < DECAY_LEVELS; i++)
+        frame.crossingNs[i] = decayCrossings.timeNs[i];
+    for (uint8_t i = 0; i < DECAY_LEVELS - 1; i++)
+        frame.crossingTauNs[i] = decayCrossings.tauNs[i];
+    frame.crossingRatio = decayCrossings.ratio;
+    frame.crossingShape = decayCrossings.shape;
+    frame.alarm = detector.alarm;
+    Telemetry_SendPulse(&frame, samples, count);
+}
 
-        uint16_t head_ptr = DMA_BUFFER_ENTRIES - dmaIndex;
+// Burst record at the DMA rate, before decimation
+void Record_Report(const uint16_t* record, uint16_t count)
+{
+    Telemetry_Record_t frame;
+    frame.sampleRateHz = sampleRateHz * acqProfiles[acqProfile].decimation;
+    frame.sampleBits = sampleBits;
+    frame.every = streamEvery;
+    Telemetry_SendRecord(&frame, record, count);
+}
+
+#if PROFILER_ENABLED
+// Every stage and its histogram since the last dump, then the counters restart
+void Task_Profiler()
+{
+    Telemetry_Profile_t frame;
+    frame.intervalMs = HAL_GetTick() - profilerResetMs;
+    frame.coreHz = SystemCoreClock;
+    frame.cycleBudget = blockCycleBudget;
+    Telemetry_SendProfile(&frame, profStages, STAGE_COUNT);
+
+    Param_Profiler();
+}
+#endif
 
-        Get_Last_N_Samples(value, linear_history, head_ptr, HISTORY_LEN, DMA_BUFFER_ENTRIES);
+// timeNsQ8: crossing of the AWD1 level, ns since the period started, Q24.8
+void Process_Pulse(uint16_t* linear_history, uint32_t timeNsQ8)
+{
+    PROF_BEGIN(STAGE_FILTER);
+    // Q15.16 microseconds
+    float val = Handle_Sample((int32_t) (((uint64_t) timeNsQ8 << 8) / 1000));
+    PROF_END(STAGE_FILTER);
 
-        float time = timerIndex * 0.02f;
-        float val = Handle_Sample(time);
-        float delta = Calculate_Slope(linear_history, HISTORY_LEN);
+    PROF_BEGIN(STAGE_DECAY_FIT);
+    Decay_Fit(linear_history, historyLen, decayBaseline, 4095 << (sampleBits - 12), sampleRateHz, &decayFit);
+    uint16_t levels[DECAY_LEVELS];
+    for (uint8_t i = 0; i < DECAY_LEVELS; i++)
+        levels[i] = crossingLevels[i] << (sampleBits - 12);
+    Decay_Crossings(&decayCrossings, levels, decayBaseline);
+    PROF_END(STAGE_DECAY_FIT);
 
-        if (debugOutputCtr > 100)
+    if (debugMode)
+    {
+        PROF_BEGIN(STAGE_PULSE_TX);
+        Pulse_Report(linear_history, historyLen, timeNsQ8, val);
+        PROF_END(STAGE_PULSE_TX);
+    }
+
+    oledTime = timeNsQ8 / 256000.0f;
+    oledStale = 1;
+}
+
+void Process_Record(uint16_t* record)
+{
+    uint32_t tail = 0;
+    for (uint16_t i = recordLen - BASELINE_SAMPLES; i < recordLen; i++)
+        tail += record[i];
+    decayBaseline = (uint16_t) (tail / BASELINE_SAMPLES);
+
+    uint16_t crossing = Find_Crossing(record, recordLen, awdLow << (sampleBits - 12));
+    uint16_t clip = 4095 << (sampleBits - 12);
+    // Sample k of the record is taken k sample periods after the CCR4 trigger
+    uint32_t triggerNsQ8 = __HAL_TIM_GET_COMPARE(&PULSE_TIMER, TIM_CHANNEL_4) * (PULSE_TICK_NS << 8);
+
+    // Every watchdog level from the same record, on the averaged pulses,
+    // interpolated between the samples either side of it
+    uint16_t fall = crossing;
+    uint32_t timeNsQ8 = triggerNsQ8 + (uint32_t) (((uint64_t) (crossing << 8) * 1000000000u) / sampleRateHz);
+    for (uint8_t i = 0; i < DECAY_LEVELS; i++)
+    {
+        uint16_t level = crossingLevels[i] << (sampleBits - 12);
+        if (i)
+            fall = Find_Below(record, fall, recordLen, level);
+        decayCrossings.timeNs[i] = 0;
+        if (fall >= recordLen || fall == 0)
+            continue;
+        uint32_t positionQ8 = ((fall - 1) << 8) + Decay_Interpolate(&record[fall - 1], recordLen - fall + 1, level, clip);
+        uint32_t fallNsQ8 = triggerNsQ8 + (uint32_t) (((uint64_t) positionQ8 * 1000000000u) / sampleRateHz);
+        decayCrossings.timeNs[i] = fallNsQ8 >> 8;
+        if (!i)
+            timeNsQ8 = fallNsQ8;
+    }
+
+    // The burst never went through the AWD low level, same as a free-running period without a crossing
+    if (crossing >= recordLen)
+        pulsesMissed++;
+    if (crossing < historyLen)
+        crossing = historyLen;
+
+    Process_Pulse(&record[crossing - historyLen], timeNsQ8);
+}
+
+void Process_Burst(uint16_t* record)
+{
+    if (!Pulse_Settled())
+        return;
+
+    // Before decimation and stacking, so the host gets the DMA rate samples
+    if (streamMode && ++streamCount >= streamEvery)
+    {
+        streamCount = 0;
+        PROF_BEGIN(STAGE_RECORD_TX);
+        Record_Report(record, burstSamples);
+        PROF_END(STAGE_RECORD_TX);
+    }
+
+    PROF_BEGIN(STAGE_DECIMATE);
+    Decimate(record, burstSamples, acqProfiles[acqProfile].decimation);
+    PROF_END(STAGE_DECIMATE);
+
+    if (stackDepth <= 1)
+    {
+        Process_Record(record);
+        return;
+    }
+
+    PROF_BEGIN(STAGE_STACK);
+    uint8_t full = Stack_Add(&stack, record);
+    if (full)
+        Stack_Average(&stack, stackedRecord, 0);
+    PROF_END(STAGE_STACK);
+
+    if (full)
+        Process_Record(stackedRecord);
+}
+
+void Process_Block(uint32_t block)
+{
+    if (pulseSync)
+    {
+        pulseSequence = blockPulse[block & 1];
+        Process_Burst((uint16_t*) &value[(block & 1) * DMA_BLOCK_ENTRIES]);
+        return;
+    }
+
+    if (!crossingPending)
+        return;
+
+    int32_t age = (int32_t) (block - crossingBlock);
+    if (age < 0)
+        return;
+
+    // Once a newer block completes the DMA is already rewriting the crossing
+    // block. The history before the crossing may reach back into the other
+    // half, which the DMA is rewriting now, see Ring_Intact.
+    if (age != 0)
+        pulsesDropped++;
+    else if (Pulse_Settled())
+    {
+        pulseSequence = crossingPulse;
+        // AWD2 and AWD3 from the raw samples before their latch, 0 for a
+        // level not passed yet or a crossing the window does not hold
+        volatile uint16_t* ticks = crossingTicks[crossingPulse % CROSSING_PERIODS];
+        volatile uint16_t* heads = crossingHeads[crossingPulse % CROSSING_PERIODS];
+        for (uint8_t i = 1; i < DECAY_LEVELS; i++)
+        {
+            uint16_t window[CROSSING_WINDOW];
+            uint16_t tick = ticks[i];
+            uint16_t head = heads[i];
+            decayCrossings.timeNs[i] = 0;
+            if (!tick)
+                continue;
+            Get_Last_N_Samples((uint16_t*) value, window, head, CROSSING_WINDOW, DMA_BUFFER_ENTRIES);
+            if (Ring_Intact(head, CROSSING_WINDOW))
+                decayCrossings.timeNs[i] = History_CrossingTime(window, CROSSING_WINDOW, 1, crossingLevels[i], tick) >> 8;
+        }
+        uint8_t decimation = acqProfiles[acqProfile].decimation;
+        uint16_t linear_history[HISTORY_MAX];
+        PROF_BEGIN(STAGE_COPY);
+        Get_Last_N_Samples((uint16_t*) value, linear_history, crossingHead, historyLen * decimation, DMA_BUFFER_ENTRIES);
+        PROF_END(STAGE_COPY);
+        if (!Ring_Intact(crossingHead, historyLen * decimation))
         {
-            if (DEBUG_MODE)
-            {
-                printf("DATA[");
-                for (int i = 0; i < HISTORY_LEN; i++)
-                {
-                    printf("%d ", linear_history[i]);
-                }
-                printf("] %d %f %f %f %f %f$\r\n", 0, time, val, delta, fastFilter.out, slowFilter.out);
-            }
-            debugOutputCtr = 0;
+            pulsesDropped++;
+            crossingPending = 0;
+            return;
         }
-        if (updateOledCtr > 250)
+        PROF_BEGIN(STAGE_DECIMATE);
+        Decimate(linear_history, historyLen * decimation, decimation);
+        PROF_END(STAGE_DECIMATE);
+        uint32_t timeNsQ8 = History_CrossingTime(linear_history, historyLen, decimation, awdLow, timerIndex);
+        if (!timeNsQ8)
+        {
+            pulsesDropped++;
+            crossingPending = 0;
+            return;
+        }
+        decayBaseline = Ring_Baseline(crossingHead, timerIndex, decimation);
+        decayCrossings.timeNs[0] = timeNsQ8 >> 8;
+        Process_Pulse(linear_history, timeNsQ8);
+    }
+
+    crossingPending = 0;
+}
+
+void Task_Block()
+{
+    uint32_t posted;
+    while ((posted = blocksPosted) != blocksProcessed)
+    {
+        if (posted - blocksProcessed > 1)
         {
-            SSD1306_Fill(Black);
-            char buf[60] = {0};
-            snprintf(buf, 60, "T: %d us", (int)time);
-            SSD1306_SetCursor(0,0);
-            SSD1306_WriteString(buf, Font_11x18, White);
-            SSD1306_SetCursor(0,20);
-            snprintf(buf, 60, "S: %d V/s", (int) delta);
-            SSD1306_WriteString(buf, Font_11x18, White);
-            SSD1306_UpdateScreen();
-            updateOledCtr = 0;
+            // The DMA has lapped the oldest pending half, its samples are gone.
+            // In pulse-sync mode every block is one burst.
+            blocksDropped += posted - blocksProcessed - 1;
+            if (pulseSync)
+                pulsesOverwritten += posted - blocksProcessed - 1;
+            blocksProcessed = posted - 1;
         }
-        end:
-        dmaIndex = 0;
+
+        uint32_t start = DWT->CYCCNT;
+        Process_Block(blocksProcessed);
+        uint32_t end = DWT->CYCCNT;
+        blockCycles = end - start;
+#if PROFILER_ENABLED
+        Prof_Add(&profStages[STAGE_BLOCK], blockCycles);
+#endif
+        if (blockCycles > blockCyclesMax)
+            blockCyclesMax = blockCycles;
+        blockLatency = end - blockPostedAt[blocksProcessed & 1];
+        if (blockLatency > blockLatencyMax)
+            blockLatencyMax = blockLatency;
+
+        blocksProcessed++;
+    }
+
+    // Free-running halves come every 245 us, a slice goes out after every other one
+    if (oledFlushing && (pulseSync || (blocksProcessed & 1)))
+        Sched_Post(&sched, TASK_DISPLAY);
+}
+
+void Task_Display()
+{
+    // The loss counters are redrawn even when no pulse gets through
+    uint32_t lost = pulsesMissed + pulsesOverwritten + pulsesDropped + adcOverruns;
+    if (oledStale || lost != oledLost)
+    {
+        PROF_BEGIN(STAGE_OLED_DRAW);
+        SSD1306_Fill(Black);
+        char buf[60] = {0};
+        snprintf(buf, 60, "T: %d us", (int)oledTime);
+        SSD1306_SetCursor(0,0);
+        SSD1306_WriteString(buf, Font_11x18, White);
+        SSD1306_SetCursor(0,20);
+        snprintf(buf, 60, "D: %lu ns", decayFit.tauNs);
+        SSD1306_WriteString(buf, Font_11x18, White);
+        // Pulse number, then missed, overwritten (or too late) and ADC overruns
+        SSD1306_SetCursor(0,42);
+        snprintf(buf, 60, "#%lu", pulseSequence);
+        SSD1306_WriteString(buf, Font_7x10, White);
+        SSD1306_SetCursor(0,53);
+        snprintf(buf, 60, "M%lu O%lu A%lu", pulsesMissed, pulsesOverwritten + pulsesDropped, adcOverruns);
+        SSD1306_WriteString(buf, Font_7x10, White);
+        oledStale = 0;
+        oledLost = lost;
+        PROF_END(STAGE_OLED_DRAW);
     }
+
+    // One slice, Task_Block posts the next one after the coming block
+    PROF_BEGIN(STAGE_OLED_FLUSH);
+    oledFlushing = SSD1306_Flush();
+    PROF_END(STAGE_OLED_FLUSH);
+}
+
+void Task_Command()
+{
+    PROF_BEGIN(STAGE_COMMAND);
+    Command_Poll();
+    PROF_END(STAGE_COMMAND);
+}
+
+static const Sched_Task_t tasks[TASK_COUNT] = {
+    [TASK_BLOCK] = Task_Block,
+    [TASK_COMMAND] = Task_Command,
+    [TASK_DISPLAY] = Task_Display,
+#if PROFILER_ENABLED
+    [TASK_PROFILER] = Task_Profiler,
+#endif
+};
+
+// One task per call, the core sleeps in WFI until an interrupt posts work
+void GitKop_Loop()
+{
+    Sched_Run(&sched, tasks, TASK_COUNT);
 }
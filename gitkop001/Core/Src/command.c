@@ -0,0 +1,234 @@
+#include "command.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "uart.h"
+
+static UART_HandleTypeDef *commandUart;
+static const Param_t *commandParams;
+static uint8_t commandCount;
+
+// DMA target, restarted after every idle line or full buffer. rxPos is the
+// part of it already copied, a half transfer event reports the same buffer again.
+static uint8_t rxDma[COMMAND_RX_SIZE];
+static uint16_t rxPos = 0;
+
+// Line assembled in the RX interrupt and parsed by Command_Poll.
+// lineReady hands the buffer over, the interrupt drops bytes until it is cleared.
+static char line[COMMAND_LINE_MAX];
+static uint8_t lineLen = 0;
+static uint8_t lineDiscard = 0;
+volatile static uint8_t lineReady = 0;
+static uint32_t rxDropped = 0;
+
+static void Command_StartRx(void) {
+    rxPos = 0;
+    if (HAL_UARTEx_ReceiveToIdle_DMA(commandUart, rxDma, COMMAND_RX_SIZE) != HAL_OK)
+        rxDropped++;
+}
+
+static void Command_Reply(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+static void Command_Reply(const char *fmt, ...) {
+    char buf[96];
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(buf, sizeof(buf) - 3, fmt, args);
+    va_end(args);
+    if (len < 0)
+        return;
+    if (len > (int) sizeof(buf) - 4)
+        len = sizeof(buf) - 4;
+
+    buf[len++] = '\r';
+    buf[len++] = '\n';
+    buf[len++] = 0;
+    _write(1, buf, len);
+}
+
+// printf is built without float support, six decimals are enough for the alphas
+static void Command_FormatFloat(char *buf, uint8_t size, float f) {
+    const char *sign = f < 0 ? "-" : "";
+    if (f < 0)
+        f = -f;
+    uint32_t whole = (uint32_t) f;
+    uint32_t frac = (uint32_t) ((f - whole) * 1000000.0f + 0.5f);
+    if (frac >= 1000000) {
+        whole++;
+        frac -= 1000000;
+    }
+    snprintf(buf, size, "%s%lu.%06lu", sign, whole, frac);
+}
+
+static void Command_Format(const Param_t *p, char *buf, uint8_t size) {
+    switch (p->type) {
+    case PARAM_U8:
+        snprintf(buf, size, "%u", *(uint8_t *) p->value);
+        break;
+    case PARAM_U16:
+        snprintf(buf, size, "%u", *(uint16_t *) p->value);
+        break;
+    case PARAM_U32:
+        snprintf(buf, size, "%lu", *(uint32_t *) p->value);
+        break;
+    case PARAM_FLOAT:
+        Command_FormatFloat(buf, size, *(float *) p->value);
+        break;
+    }
+}
+
+static const Param_t *Command_Find(const char *name) {
+    for (uint8_t i = 0; i < commandCount; i++) {
+        if (strcmp(commandParams[i].name, name) == 0)
+            return &commandParams[i];
+    }
+    return NULL;
+}
+
+static void Command_Show(const Param_t *p) {
+    char value[24];
+    Command_Format(p, value, sizeof(value));
+    Command_Reply("OK %s=%s", p->name, value);
+}
+
+static void Command_Set(const Param_t *p, const char *text) {
+    char *end;
+    float f = strtof(text, &end);
+    if (end == text || *end != 0) {
+        Command_Reply("ERR %s: bad value '%s'", p->name, text);
+        return;
+    }
+    if (f < p->min)
+        f = p->min;
+    if (f > p->max)
+        f = p->max;
+
+    // Integers round to nearest, min is never negative for them
+    switch (p->type) {
+    case PARAM_U8:
+        *(uint8_t *) p->value = (uint8_t) (f + 0.5f);
+        break;
+    case PARAM_U16:
+        *(uint16_t *) p->value = (uint16_t) (f + 0.5f);
+        break;
+    case PARAM_U32:
+        *(uint32_t *) p->value = (uint32_t) (f + 0.5f);
+        break;
+    case PARAM_FLOAT:
+        *(float *) p->value = f;
+        break;
+    }
+    if (p->apply)
+        p->apply();
+    Command_Show(p);
+}
+
+static void Command_Execute(char *cmd) {
+    char *verb = strtok(cmd, " \t");
+    char *name = strtok(NULL, " \t");
+    char *arg = strtok(NULL, " \t");
+
+    if (verb == NULL)
+        return;
+
+    if (strcmp(verb, "list") == 0) {
+        for (uint8_t i = 0; i < commandCount; i++) {
+            char value[24], min[24], max[24];
+            Command_Format(&commandParams[i], value, sizeof(value));
+            Command_FormatFloat(min, sizeof(min), commandParams[i].min);
+            Command_FormatFloat(max, sizeof(max), commandParams[i].max);
+            Command_Reply("%s=%s [%s, %s]", commandParams[i].name, value, min, max);
+        }
+        Command_Reply("OK %u parameters, %lu bytes dropped", commandCount, rxDropped);
+        return;
+    }
+
+    const Param_t *p = name ? Command_Find(name) : NULL;
+    if (strcmp(verb, "get") == 0 && p)
+        Command_Show(p);
+    else if (strcmp(verb, "set") == 0 && p && arg)
+        Command_Set(p, arg);
+    else if (name && !p)
+        Command_Reply("ERR unknown parameter '%s'", name);
+    else
+        Command_Reply("ERR usage: list | get <name> | set <name> <value>");
+}
+
+/**
+ * @brief Start listening for commands.
+ * * @param huart UART with an RX DMA channel linked.
+ * @param params Parameter table, kept by reference.
+ * @param count Number of entries in params.
+ */
+void Command_Init(UART_HandleTypeDef *huart, const Param_t *params, uint8_t count) {
+    commandUart = huart;
+    commandParams = params;
+    commandCount = count;
+    Command_StartRx();
+}
+
+/**
+ * @brief Parse and execute a received line, if there is one.
+ * Call from the main loop between pulses: sets and their apply hooks run
+ * here, so the pulse processing never sees a half applied change.
+ */
+void Command_Poll(void) {
+    if (!lineReady)
+        return;
+
+    Command_Execute(line);
+
+    lineLen = 0;
+    __DMB();
+    lineReady = 0;
+}
+
+// From HAL_UARTEx_RxEventCallback: copy the new bytes into line, no parsing here
+void Command_RxEvent(UART_HandleTypeDef *huart, uint16_t size) {
+    if (huart != commandUart)
+        return;
+
+    for (uint16_t i = rxPos; i < size && i < COMMAND_RX_SIZE; i++) {
+        char c = rxDma[i];
+        uint8_t eol = c == '\r' || c == '\n';
+        if (lineReady) {
+            // The LF of a CRLF is not a lost byte
+            if (!eol)
+                rxDropped++;
+            continue;
+        }
+        if (eol) {
+            if (lineLen && !lineDiscard) {
+                line[lineLen] = 0;
+                lineReady = 1;
+            } else {
+                lineLen = 0;
+            }
+            lineDiscard = 0;
+        } else if (lineLen < COMMAND_LINE_MAX - 1) {
+            line[lineLen++] = c;
+        } else {
+            // Too long, ignore the rest of the line
+            rxDropped++;
+            lineLen = 0;
+            lineDiscard = 1;
+        }
+    }
+    rxPos = size;
+
+    // Idle line and transfer complete both end the DMA transfer in normal mode
+    if (HAL_UARTEx_GetRxEventType(huart) != HAL_UART_RXEVENT_HT)
+        Command_StartRx();
+}
+
+// From HAL_UART_ErrorCallback: noise or overrun aborts the reception
+void Command_RxError(UART_HandleTypeDef *huart) {
+    if (huart != commandUart || huart->RxState != HAL_UART_STATE_READY)
+        return;
+
+    rxDropped++;
+    Command_StartRx();
+}
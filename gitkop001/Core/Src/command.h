@@ -0,0 +1,39 @@
+#ifndef COMMAND_H
+#define COMMAND_H
+
+#include <stdint.h>
+
+#include "usart.h"
+
+// Line based command channel on the UART RX line:
+//   list               all parameters with their value and range
+//   get <name>         one parameter
+//   set <name> <value> clamp, store and apply one parameter
+// Every reply is a text line followed by 0x00, so it is framed the same way
+// as the binary telemetry.
+
+#define COMMAND_RX_SIZE 64
+#define COMMAND_LINE_MAX 64
+
+typedef enum {
+    PARAM_U8,
+    PARAM_U16,
+    PARAM_U32,
+    PARAM_FLOAT
+} Param_Type_t;
+
+typedef struct {
+    const char *name;
+    Param_Type_t type;
+    void *value;
+    float min;
+    float max;
+    void (*apply)(void); // Called after a set, from Command_Poll, may be NULL
+} Param_t;
+
+void Command_Init(UART_HandleTypeDef *huart, const Param_t *params, uint8_t count);
+void Command_Poll(void);
+void Command_RxEvent(UART_HandleTypeDef *huart, uint16_t size);
+void Command_RxError(UART_HandleTypeDef *huart);
+
+#endif
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#include "cmsis_compiler.h"
+#endif
+
+#define DECAY_MAX_SAMPLES 48
+// Falling levels timed per pulse, one per ADC analog watchdog
+#define DECAY_LEVELS 3
+// 1 / ln 2 in Q10
+#define DECAY_INV_LN2_Q10 1477
+
+typedef struct {
+    uint32_t tauNs;     // Decay time constant, 0 when the window is not decaying
+    uint16_t amplitude; // Fitted height above baseline at the first unclipped sample, ADC counts
+    uint16_t residual;  // RMS fit error, per mille of the signal
+} Decay_Fit_t;
+
+typedef struct {
+    uint32_t timeNs[DECAY_LEVELS];    // Fall through each level since the period started, 0 if it did not cross
+    uint32_t tauNs[DECAY_LEVELS - 1]; // Time constant between neighbouring levels, 0 when not measurable
+    uint16_t ratio;                   // (t3 - t2) / (t2 - t1), Q10, independent of the baseline
+    uint16_t shape;                   // tau23 / tau12, Q10, 1024 for a single exponential
+} Decay_Crossings_t;
+
+// log2(1 + i / 16) in Q10
+static const uint16_t decayLog2Lut[17] = {
+    0, 90, 174, 254, 330, 402, 470, 536, 599, 659, 717, 773, 827, 879, 929, 977, 1024
+};
+
+/**
+ * @brief Integer log2 in Q10, table lookup with linear interpolation.
+ * * @param v Value from 1 to 65535.
+ * @return log2(v) * 1024, error below 1 LSB.
+ */
+static inline int16_t Decay_Log2(uint32_t v) {
+    uint32_t e = 31 - __builtin_clz(v);
+    uint32_t m = (v << (16 - e)) & 0xFFFF;
+    uint32_t i = m >> 12;
+    uint32_t f = m & 0xFFF;
+    uint32_t step = decayLog2Lut[i + 1] - decayLog2Lut[i];
+    return (int16_t) ((e << 10) + decayLog2Lut[i] + ((step * f + 2048) >> 12));
+}
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#define Decay_Smlad __SMLAD
+#define Decay_Smlald __SMLALD
+#else
+static inline uint32_t Decay_Smlad(uint32_t x, uint32_t y, uint32_t acc) {
+    return acc + (int16_t) x * (int16_t) y + (int16_t) (x >> 16) * (int16_t) (y >> 16);
+}
+
+static inline uint64_t Decay_Smlald(uint32_t x, uint32_t y, uint64_t acc) {
+    return acc + (int64_t) ((int16_t) x * (int16_t) y) + (int64_t) ((int16_t) (x >> 16) * (int16_t) (y >> 16));
+}
+#endif
+
+/**
+ * @brief Least-squares fit of s[i] - baseline = A * exp(-t / tau) over the window.
+ * Straight line regression on log2 of the samples. The per-sample work is one
+ * table log2 and dual 16 bit multiply-accumulates; the closed form solution is
+ * evaluated once per call. A clipped sample only says the signal was above
+ * full scale, the fit starts after the last one.
+ * * @param samples Decaying window, n values on the ADC scale.
+ * @param n Window length, up to DECAY_MAX_SAMPLES, 3 left after clipping.
+ * @param baseline Level the decay settles to, samples at or below it count as 1.
+ * @param clip Full scale of the samples.
+ * @param sampleRateHz Rate of the samples in the window.
+ * @param fit Output, zeroed when the window does not decay.
+ * @return 1 when the fit is valid.
+ */
+static inline uint8_t Decay_Fit(const uint16_t *samples, uint16_t n, uint16_t baseline, uint16_t clip,
+                                uint32_t sampleRateHz, Decay_Fit_t *fit) {
+    fit->tauNs = 0;
+    fit->amplitude = 0;
+    fit->residual = 0;
+    if (n > DECAY_MAX_SAMPLES)
+        n = DECAY_MAX_SAMPLES;
+    for (uint16_t k = n; k > 0; k--) {
+        if (samples[k - 1] >= clip) {
+            samples += k;
+            n -= k;
+            break;
+        }
+    }
+    if (n < 3 || sampleRateHz == 0)
+        return 0;
+
+    // y = log2(s - baseline) in Q10 fits int16, x = i, two of each per word
+    uint32_t sy = 0;
+    uint32_t sxy = 0;
+    uint64_t syy = 0;
+    uint16_t i = 0;
+    for (; i + 1 < n; i += 2) {
+        uint32_t y0 = samples[i] > baseline ? Decay_Log2(samples[i] - baseline) : 0;
+        uint32_t y1 = samples[i + 1] > baseline ? Decay_Log2(samples[i + 1] - baseline) : 0;
+        uint32_t y = (y1 << 16) | y0;
+        uint32_t x = ((uint32_t) (i + 1) << 16) | i;
+        sy = Decay_Smlad(y, 0x00010001, sy);
+        sxy = Decay_Smlad(x, y, sxy);
+        syy = Decay_Smlald(y, y, syy);
+    }
+    if (i < n) {
+        uint32_t y = samples[i] > baseline ? Decay_Log2(samples[i] - baseline) : 0;
+        sy += y;
+        sxy += i * y;
+        syy += y * y;
+    }
+
+    int64_t sx = (int64_t) n * (n - 1) / 2;
+    int64_t sxx = (int64_t) n * (n - 1) * (2 * n - 1) / 6;
+    int64_t d = n * sxx - sx * sx;
+    int64_t bNum = (int64_t) n * sxy - sx * (int64_t) sy;
+    if (bNum >= 0)
+        return 0;
+
+    // Slope in log2 per sample and intercept in log2, both back from Q10
+    float b = (float) bNum / (float) d / 1024.0f;
+    float a = ((float) sy / 1024.0f - b * (float) sx) / n;
+
+    float tau = 1e9f / ((float) sampleRateHz * -b * (float) M_LN2);
+    fit->tauNs = tau < 4e9f ? (uint32_t) tau : 4000000000u;
+    float amplitude = exp2f(a);
+    fit->amplitude = amplitude < 65535.0f ? (uint16_t) amplitude : 65535;
+
+    // n times the residual sum of squares: n * Syy - Sy^2 - bNum^2 / d, in Q20
+    int64_t ssr = (int64_t) n * (int64_t) syy - (int64_t) sy * sy - bNum * bNum / d;
+    if (ssr < 0)
+        ssr = 0;
+    float rms = sqrtf((float) ssr) / n / 1024.0f;
+    fit->residual = (uint16_t) (rms * (float) M_LN2 * 1000.0f + 0.5f);
+    return 1;
+}
+
+/**
+ * @brief Decay shape from the times the signal fell through a few fixed levels.
+ * Between two crossings tau = dt / ln((l1 - baseline) / (l2 - baseline)). A
+ * single exponential gives the same tau on every segment, a slow target
+ * component stretches the lower ones, which shape measures.
+ * * @param crossings timeNs filled in, tauNs, ratio and shape are written.
+ * @param levels DECAY_LEVELS falling levels, highest first, on the ADC scale.
+ * @param baseline Level the decay settles to.
+ */
+static inline void Decay_Crossings(Decay_Crossings_t *crossings, const uint16_t *levels, uint16_t baseline) {
+    const uint32_t *t = crossings->timeNs;
+    for (uint8_t i = 0; i < DECAY_LEVELS - 1; i++) {
+        crossings->tauNs[i] = 0;
+        if (!t[i] || t[i + 1] <= t[i] || levels[i + 1] <= baseline || levels[i] <= levels[i + 1])
+            continue;
+        int32_t dlog = Decay_Log2(levels[i] - baseline) - Decay_Log2(levels[i + 1] - baseline);
+        if (dlog > 0)
+            crossings->tauNs[i] = (uint32_t) (((uint64_t) (t[i + 1] - t[i]) * DECAY_INV_LN2_Q10) / dlog);
+    }
+
+    uint64_t ratio = 0;
+    if (t[0] && t[1] > t[0] && t[2] > t[1])
+        ratio = ((uint64_t) (t[2] - t[1]) << 10) / (t[1] - t[0]);
+    crossings->ratio = ratio < 65535 ? (uint16_t) ratio : 65535;
+
+    uint64_t shape = 0;
+    if (crossings->tauNs[0] && crossings->tauNs[1])
+        shape = ((uint64_t) crossings->tauNs[1] << 10) / crossings->tauNs[0];
+    crossings->shape = shape < 65535 ? (uint16_t) shape : 65535;
+}
+
+/**
+ * @brief Sub-sample position where a falling signal passes a level.
+ * A parabola through the bracketing pair and the sample after it follows the
+ * curvature of the decay; a straight line between the pair is used when the
+ * third sample is missing or clipped, or the parabola has no root in between.
+ * * @param s Samples, s[0] >= level > s[1].
+ * @param n Samples available from s, 2 or more.
+ * @param level Level on the sample scale.
+ * @param clip Full scale, a clipped s[0] says nothing about the curvature.
+ * @return Position of the crossing after s[0], Q8 of a sample period, 0 to 256.
+ */
+static inline uint16_t Decay_Interpolate(const uint16_t *s, uint16_t n, uint16_t level, uint16_t clip) {
+    float a = s[0], b = s[1];
+    float x = (a - level) / (a - b);
+
+    if (n >= 3 && s[0] < clip) {
+        // p(x) = a + B x + A x^2 through (0, a), (1, b), (2, c)
+        float c = s[2];
+        float A = (a - 2.0f * b + c) * 0.5f;
+        float B = (4.0f * b - 3.0f * a - c) * 0.5f;
+        float C = a - level;
+        float disc = B * B - 4.0f * A * C;
+        // The root nearest s[0], in the form that stays exact as A goes to 0
+        float q = disc >= 0.0f ? sqrtf(disc) - B : 0.0f;
+        if (q > 0.0f) {
+            float root = 2.0f * C / q;
+            if (root >= 0.0f && root <= 1.0f)
+                x = root;
+        }
+    }
+    if (x < 0.0f)
+        x = 0.0f;
+    if (x > 1.0f)
+        x = 1.0f;
+    return (uint16_t) (x * 256.0f + 0.5f);
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "filters.h"
+
+// Mean absolute deviation of gaussian noise is sigma * sqrt(2 / pi)
+#define DETECTOR_SIGMA_PER_MAD FILT_FROM_FLOAT(1.2533f)
+
+typedef struct {
+    EMA_t mean;        // Running mean of the detection signal, Q15.16
+    EMA_t mad;         // Running mean absolute deviation from it, Q15.16
+    EMA_t rate;        // Alarm onsets per 1000 pulses, Q15.16
+    int32_t kOn;       // Alarm raised above mean + kOn * sigma, Q15.16
+    int32_t kOff;      // and cleared below mean + kOff * sigma, Q15.16
+    int32_t sigmaMin;  // Floor for sigma, keeps a silent input from alarming on 1 LSB, Q15.16
+    int32_t sigma;     // Current noise estimate, Q15.16
+    int32_t threshold; // Current alarm level, Q15.16
+    int32_t onsetUnit; // Rate filter input for one onset, Q15.16
+    uint32_t alarms;   // Alarm onsets since init
+    uint16_t warmup;   // Updates left before alarms are allowed
+    uint8_t alarm;
+} Detector_t;
+
+/**
+ * @brief Initialize the adaptive (CFAR style) detector.
+ * Noise statistics are exponentially weighted, so the cost per update is
+ * constant and no history is kept.
+ * * @param det Pointer to the detector object.
+ * @param alpha Noise statistics smoothing factor, Q31. The estimate spans about 1 / alpha updates.
+ * @param kOn Alarm level in sigmas, Q15.16.
+ * @param kOff Release level in sigmas, Q15.16, below kOn for hysteresis.
+ * @param sigmaMin Lower limit for sigma, Q15.16.
+ * @param pulsesPerUpdate Pulses behind every update, scales the alarm rate.
+ */
+static inline void Detector_Init(Detector_t *det, int32_t alpha, int32_t kOn, int32_t kOff, int32_t sigmaMin,
+                                 uint16_t pulsesPerUpdate) {
+    EMA_Init(&det->mean, alpha, 0);
+    EMA_Init(&det->mad, alpha, sigmaMin);
+    EMA_Init(&det->rate, alpha, 0);
+    det->kOn = kOn;
+    det->kOff = kOff;
+    det->sigmaMin = sigmaMin;
+    det->sigma = sigmaMin;
+    det->threshold = 0;
+    det->onsetUnit = FILT_FROM_INT(1000) / (pulsesPerUpdate ? pulsesPerUpdate : 1);
+    det->alarms = 0;
+    det->alarm = 0;
+
+    // Let the statistics converge before trusting them
+    uint32_t span = alpha ? FILT_Q31_ONE / alpha : 0;
+    det->warmup = span < 65535 ? span : 65535;
+}
+
+/**
+ * @brief Feed one value of the detection signal.
+ * Statistics are frozen while the alarm is active so a target does not
+ * inflate its own threshold.
+ * * @param det Pointer to the detector object.
+ * @param x Detection signal, Q15.16.
+ * @return 1 while the alarm is active.
+ */
+static inline uint8_t Detector_Update(Detector_t *det, int32_t x) {
+    int32_t dev = x - det->mean.out;
+    uint8_t onset = 0;
+
+    if (det->warmup)
+        det->warmup--;
+
+    int32_t on = det->mean.out + (int32_t) (((int64_t) det->kOn * det->sigma) >> FILT_Q);
+    int32_t off = det->mean.out + (int32_t) (((int64_t) det->kOff * det->sigma) >> FILT_Q);
+
+    if (det->alarm) {
+        if (x < off)
+            det->alarm = 0;
+    } else if (x > on && !det->warmup) {
+        det->alarm = 1;
+        det->alarms++;
+        onset = 1;
+    }
+    det->threshold = det->alarm ? off : on;
+
+    if (!det->alarm) {
+        EMA_Update(&det->mean, x);
+        EMA_Update(&det->mad, dev < 0 ? -dev : dev);
+        det->sigma = (int32_t) (((int64_t) det->mad.out * DETECTOR_SIGMA_PER_MAD) >> FILT_Q);
+        if (det->sigma < det->sigmaMin)
+            det->sigma = det->sigmaMin;
+    }
+    EMA_Update(&det->rate, onset ? det->onsetUnit : 0);
+
+    return det->alarm;
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <stdint.h>
+
+// Signal values are Q15.16 in an int32_t. The filters work on differences of
+// two values (input minus state, input minus the previous input), so inputs
+// must stay within +-16383 for those to fit: microsecond timings and 12 to 14
+// bit ADC counts do, 16 bit oversampled counts do not. Steps into the DC
+// blocker have to stay below 16383 as well, its output follows them.
+// host/filters_ref.c checks every filter here against a double model.
+#define FILT_Q 16
+#define FILT_FROM_INT(x) ((int32_t) (x) * (1 << FILT_Q))
+#define FILT_FROM_FLOAT(x) ((int32_t) ((x) * (float) (1 << FILT_Q)))
+#define FILT_TO_INT(x) ((x) >> FILT_Q)
+#define FILT_TO_FLOAT(x) ((float) (x) / (float) (1 << FILT_Q))
+
+// Coefficients: Q31 for the single pole filters (0 <= c < 1),
+// Q30 for the biquad so |a1| up to 2 fits
+#define FILT_Q31_ONE 2147483647
+#define FILT_Q30_ONE (1 << 30)
+
+/**
+ * @brief Convert a float coefficient in [0, 1) to Q31, saturating at the ends.
+ * Only meant for setup, nothing in the update path touches floats.
+ */
+static inline int32_t Filt_Q31(float c) {
+    float q = c * 2147483648.0f;
+    if (q <= 0.0f)
+        return 0;
+    if (q >= 2147483647.0f)
+        return FILT_Q31_ONE;
+    return (int32_t) q;
+}
+
+/**
+ * @brief Convert a float coefficient in (-2, 2) to Q30.
+ */
+static inline int32_t Filt_Q30(float c) {
+    return (int32_t) (c * (float) FILT_Q30_ONE);
+}
+
+// Multiply a Q15.16 value by a Q31 coefficient, rounded to nearest
+static inline int32_t Filt_MulQ31(int32_t x, int32_t c) {
+    return (int32_t) (((int64_t) x * c + (1LL << 30)) >> 31);
+}
+
+typedef struct {
+    int32_t alpha; // Smoothing factor, Q31. Lower = slower/smoother.
+    int32_t out;   // Current internal state, Q15.16
+} EMA_t;
+
+/**
+ * @brief Initialize the EMA filter.
+ * * @param filt Pointer to the EMA object.
+ * @param alpha Smoothing factor in Q31, see Filt_Q31.
+ * @param initial_val Starting value in Q15.16 to prevent startup glitches.
+ */
+static inline void EMA_Init(EMA_t *filt, int32_t alpha, int32_t initial_val) {
+    filt->alpha = alpha;
+    filt->out = initial_val;
+}
+
+/**
+ * @brief Update the filter with a new sample.
+ * Formula: Out = Old_Out + Alpha * (In - Old_Out)
+ * The state keeps 16 fractional bits, so with alpha = 0.0005 the slow tracker
+ * settles to within 1/64 of an input LSB, the same way on every run.
+ * * @param filt Pointer to the EMA object.
+ * @param input The new sample, Q15.16.
+ * @return The filtered value, Q15.16.
+ */
+static inline int32_t EMA_Update(EMA_t *filt, int32_t input) {
+    filt->out += Filt_MulQ31(input - filt->out, filt->alpha);
+    return filt->out;
+}
+
+/**
+ * @brief Reset the filter output to a specific value immediately.
+ * Useful if you detect a large jump and want to reset the average.
+ */
+static inline void EMA_Reset(EMA_t *filt, int32_t new_val) {
+    filt->out = new_val;
+}
+
+typedef struct {
+    int32_t b0, b1, b2; // Feed-forward coefficients, Q30
+    int32_t a1, a2;     // Feedback coefficients, Q30, sign as in y = b.x - a.y
+    int32_t x1, x2;     // Input history, Q15.16
+    int32_t y1, y2;     // Output history, Q15.16
+} Biquad_t;
+
+/**
+ * @brief Initialize a direct form I biquad section.
+ * Coefficients are normalized to a0 = 1 and given in Q30 (see Filt_Q30).
+ * Stable sections with |b| <= 1 have headroom in the 64 bit accumulator for
+ * inputs up to +-16383, the sum is rounded once.
+ */
+static inline void Biquad_Init(Biquad_t *filt, int32_t b0, int32_t b1, int32_t b2, int32_t a1, int32_t a2,
+                               int32_t initial_val) {
+    filt->b0 = b0;
+    filt->b1 = b1;
+    filt->b2 = b2;
+    filt->a1 = a1;
+    filt->a2 = a2;
+    filt->x1 = filt->x2 = initial_val;
+    filt->y1 = filt->y2 = initial_val;
+}
+
+static inline int32_t Biquad_Update(Biquad_t *filt, int32_t input) {
+    int64_t acc = (int64_t) filt->b0 * input + (int64_t) filt->b1 * filt->x1 + (int64_t) filt->b2 * filt->x2 -
+                  (int64_t) filt->a1 * filt->y1 - (int64_t) filt->a2 * filt->y2;
+    int32_t out = (int32_t) ((acc + (1LL << 29)) >> 30);
+
+    filt->x2 = filt->x1;
+    filt->x1 = input;
+    filt->y2 = filt->y1;
+    filt->y1 = out;
+    return out;
+}
+
+#define MOVING_AVG_MAX_LOG2 6
+
+typedef struct {
+    int32_t window[1 << MOVING_AVG_MAX_LOG2]; // Last samples, Q15.16
+    int64_t sum;                              // Running sum of window
+    uint8_t log2Len;                          // Window of 2^log2Len samples
+    uint8_t pos;
+} MovingAvg_t;
+
+/**
+ * @brief Initialize a boxcar average over 2^log2Len samples.
+ * The running sum is updated incrementally, so the cost is O(1) per sample
+ * regardless of the length, and the division is a shift.
+ */
+static inline void MovingAvg_Init(MovingAvg_t *filt, uint8_t log2Len, int32_t initial_val) {
+    if (log2Len > MOVING_AVG_MAX_LOG2)
+        log2Len = MOVING_AVG_MAX_LOG2;
+    filt->log2Len = log2Len;
+    filt->pos = 0;
+    for (uint16_t i = 0; i < (1u << log2Len); i++)
+        filt->window[i] = initial_val;
+    filt->sum = (int64_t) initial_val << log2Len;
+}
+
+static inline int32_t MovingAvg_Update(MovingAvg_t *filt, int32_t input) {
+    filt->sum += input - filt->window[filt->pos];
+    filt->window[filt->pos] = input;
+    filt->pos = (filt->pos + 1) & ((1u << filt->log2Len) - 1);
+    return (int32_t) ((filt->sum + ((1LL << filt->log2Len) >> 1)) >> filt->log2Len);
+}
+
+typedef struct {
+    int32_t pole; // Q31, closer to 1 = lower cutoff
+    int32_t x1;   // Previous input, Q15.16
+    int32_t out;  // Current output, Q15.16
+} DcBlock_t;
+
+/**
+ * @brief Initialize a DC blocker: y[n] = x[n] - x[n-1] + pole * y[n-1].
+ * Removes the static offset while passing changes, the cutoff is about
+ * (1 - pole) * rate / 2pi.
+ */
+static inline void DcBlock_Init(DcBlock_t *filt, int32_t pole, int32_t initial_val) {
+    filt->pole = pole;
+    filt->x1 = initial_val;
+    filt->out = 0;
+}
+
+static inline int32_t DcBlock_Update(DcBlock_t *filt, int32_t input) {
+    filt->out = input - filt->x1 + Filt_MulQ31(filt->out, filt->pole);
+    filt->x1 = input;
+    return filt->out;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "stm32h5xx.h"
+
+// Per-stage cycle statistics from the DWT cycle counter. 0 compiles the
+// PROF_BEGIN/PROF_END pairs to nothing, so instrumented code costs nothing.
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+// Bin n counts durations of 2^(n - 1) to 2^n - 1 cycles (bin 0 is zero),
+// the last bin also takes everything longer: 2^18 is past one pulse period
+#define PROF_BINS 20
+
+typedef struct {
+    const char *name;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t hist[PROF_BINS];
+} Prof_Stage_t;
+
+/**
+ * @brief Clear the counters of a stage, the name is kept.
+ * * @param stage Pointer to the stage.
+ */
+static inline void Prof_Reset(Prof_Stage_t *stage) {
+    stage->count = 0;
+    stage->min = UINT32_MAX;
+    stage->max = 0;
+    stage->sum = 0;
+    for (uint8_t i = 0; i < PROF_BINS; i++)
+        stage->hist[i] = 0;
+}
+
+/**
+ * @brief Account one run of a stage.
+ * About 20 cycles, no division: the bin is the bit length of the duration.
+ * * @param stage Pointer to the stage.
+ * @param cycles Duration of the run.
+ */
+static inline void Prof_Add(Prof_Stage_t *stage, uint32_t cycles) {
+    stage->count++;
+    stage->sum += cycles;
+    if (cycles < stage->min)
+        stage->min = cycles;
+    if (cycles > stage->max)
+        stage->max = cycles;
+
+    uint8_t bin = cycles ? 32 - __builtin_clz(cycles) : 0;
+    stage->hist[bin < PROF_BINS ? bin : PROF_BINS - 1]++;
+}
+
+static inline uint32_t Prof_Mean(const Prof_Stage_t *stage) {
+    return stage->count ? (uint32_t) (stage->sum / stage->count) : 0;
+}
+
+// PROF_BEGIN(id) ... PROF_END(id) times the code between them into
+// profStages[id], a Prof_Stage_t table the instrumented file defines.
+// Both must be in the same scope, a pair can nest inside another.
+#if PROFILER_ENABLED
+#define PROF_BEGIN(id) uint32_t profStart_##id = DWT->CYCCNT
+#define PROF_END(id) Prof_Add(&profStages[id], DWT->CYCCNT - profStart_##id)
+#else
+#define PROF_BEGIN(id) do { } while (0)
+#define PROF_END(id) do { } while (0)
+#endif
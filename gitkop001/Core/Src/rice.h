@@ -0,0 +1,87 @@
+#pragma once
+
+#include <stdint.h>
+
+// Quotients from RICE_ESCAPE up are sent as RICE_ESCAPE ones followed by the
+// zigzag value in RICE_RAW_BITS, which bounds the size of a noisy sample
+#define RICE_ESCAPE 24
+#define RICE_RAW_BITS 17
+#define RICE_MAX_K 15
+
+typedef struct {
+    uint8_t *out;
+    uint16_t pos;
+    uint16_t size;
+    uint32_t acc;
+    uint8_t bits;
+} Rice_Writer_t;
+
+static inline uint32_t Rice_Zigzag(int32_t d) {
+    return ((uint32_t) d << 1) ^ (uint32_t) (d >> 31);
+}
+
+// Append n <= 24 bits, MSB first
+static inline void Rice_Put(Rice_Writer_t *w, uint32_t value, uint8_t n) {
+    w->acc = (w->acc << n) | value;
+    w->bits += n;
+    while (w->bits >= 8 && w->pos < w->size) {
+        w->bits -= 8;
+        w->out[w->pos++] = (uint8_t) (w->acc >> w->bits);
+    }
+}
+
+/**
+ * @brief Parameter for the deltas of a record: about log2 of the mean zigzag delta.
+ * Decay curves are smooth, so k is small and most samples take k + 1 to k + 3 bits.
+ */
+static inline uint8_t Rice_ChooseK(const uint16_t *samples, uint16_t n) {
+    uint32_t sum = 0;
+    for (uint16_t i = 1; i < n; i++)
+        sum += Rice_Zigzag((int32_t) samples[i] - samples[i - 1]);
+
+    uint32_t mean = n > 1 ? sum / (n - 1) : 0;
+    if (mean < 2)
+        return 0;
+    uint8_t k = 31 - __builtin_clz(mean);
+    return k > RICE_MAX_K ? RICE_MAX_K : k;
+}
+
+/**
+ * @brief Rice code the sample to sample deltas of a record.
+ * samples[0] is not coded, it travels in the frame header.
+ * * @param samples Record to encode.
+ * @param n Number of samples.
+ * @param k Rice parameter from Rice_ChooseK.
+ * @param out Output buffer.
+ * @param size Size of out.
+ * @return Encoded bytes, 0 if the result would not fit in size.
+ */
+static inline uint16_t Rice_Encode(const uint16_t *samples, uint16_t n, uint8_t k, uint8_t *out, uint16_t size) {
+    Rice_Writer_t w = { out, 0, size, 0, 0 };
+    uint32_t mask = (1u << k) - 1;
+
+    for (uint16_t i = 1; i < n; i++) {
+        uint32_t z = Rice_Zigzag((int32_t) samples[i] - samples[i - 1]);
+        uint32_t q = z >> k;
+
+        if (q >= RICE_ESCAPE) {
+            Rice_Put(&w, (1u << RICE_ESCAPE) - 1, RICE_ESCAPE);
+            Rice_Put(&w, z, RICE_RAW_BITS);
+        } else {
+            // q ones and the terminating zero, then the k low bits
+            Rice_Put(&w, ((1u << q) - 1) << 1, q + 1);
+            if (k)
+                Rice_Put(&w, z & mask, k);
+        }
+        if (w.pos >= size)
+            return 0;
+    }
+
+    // Pad the last byte with zeros
+    if (w.bits) {
+        if (w.pos >= size)
+            return 0;
+        out[w.pos++] = (uint8_t) (w.acc << (8 - w.bits));
+    }
+    return w.pos;
+}
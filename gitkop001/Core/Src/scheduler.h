@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "stm32h5xx.h"
+
+// Work items are bits in one word: interrupts post them, the main loop takes
+// the lowest set bit first, so the bit number is the priority (0 runs first).
+#define SCHED_MAX_TASKS 32
+
+typedef void (*Sched_Task_t)(void);
+
+typedef struct {
+    volatile uint32_t pending; // Posted and not yet taken
+    uint32_t wakeups;          // WFI exits, each one an interrupt that ended a sleep
+} Sched_t;
+
+/**
+ * @brief Post a work item, callable from any interrupt priority.
+ * Posting an item that is already pending is a no-op, the task runs once.
+ * * @param sched Pointer to the scheduler.
+ * @param task Task number, 0 is the highest priority.
+ */
+static inline void Sched_Post(Sched_t *sched, uint8_t task) {
+    __atomic_fetch_or(&sched->pending, 1UL << task, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Take the highest priority pending task, sleeping in WFI while there is none.
+ * Interrupts are masked between the check and the WFI, so a post that lands
+ * in between still wakes the core: a pending interrupt ends WFI even with
+ * PRIMASK set, and it is then serviced before the check runs again.
+ * * @param sched Pointer to the scheduler.
+ * @return Task number of the taken item, its bit is cleared.
+ */
+static inline uint8_t Sched_Wait(Sched_t *sched) {
+    __disable_irq();
+    while (sched->pending == 0) {
+        __DSB();
+        __WFI();
+        sched->wakeups++;
+        __enable_irq();
+        __ISB();
+        __disable_irq();
+    }
+
+    uint8_t task = __builtin_ctz(sched->pending);
+    sched->pending &= ~(1UL << task);
+    __enable_irq();
+    return task;
+}
+
+/**
+ * @brief Run one task: wait for the highest priority pending item and call its handler.
+ * * @param sched Pointer to the scheduler.
+ * @param tasks Handlers indexed by task number.
+ * @param count Number of entries in tasks, items posted past it are dropped.
+ */
+static inline void Sched_Run(Sched_t *sched, const Sched_Task_t *tasks, uint8_t count) {
+    uint8_t task = Sched_Wait(sched);
+    if (task < count && tasks[task])
+        tasks[task]();
+}
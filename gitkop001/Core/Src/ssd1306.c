@@ -13,6 +13,25 @@ typedef struct {
 
 static SSD1306_t SSD1306;
 
+#define SSD1306_PAGES (SSD1306_HEIGHT / 8)
+
+/* Dirty tracking: the column range touched on every page since it was last
+ * flushed (min > max when clean), and a copy of what the panel shows so a
+ * redraw with the same content sends nothing. Pages in SSD1306_Unknown are
+ * sent whole without comparing. */
+static uint8_t SSD1306_Shown[sizeof(SSD1306_Buffer)];
+static uint8_t SSD1306_DirtyMin[SSD1306_PAGES];
+static uint8_t SSD1306_DirtyMax[SSD1306_PAGES];
+static uint8_t SSD1306_Unknown = 0xFF;
+static uint8_t SSD1306_NextPage = 0;
+
+/* Transaction as sent on the bus: the address window commands, each behind
+ * a Co = 1 control byte, then 0x40 and the changed span of one page. */
+#define SSD1306_TX_HEADER 13
+#define SSD1306_TX_SIZE (SSD1306_TX_HEADER + SSD1306_WIDTH)
+
+static uint8_t SSD1306_Tx[SSD1306_TX_SIZE];
+
 /* =========================================================================
  * LOW LEVEL SOFT I2C IMPLEMENTATION
  * ========================================================================= */
@@ -65,23 +84,40 @@ static void SW_I2C_WriteByte(uint8_t data) {
     SSD1306_SCL_CLR();
 }
 
-static void SSD1306_WriteCommand(uint8_t command) {
+/* A transaction goes out in slices of SSD1306_SLICE_BYTES from SSD1306_Flush.
+ * Between slices the master holds SCL low, the panel just waits for the next
+ * clock, so the bus needs no attention while the detector works. */
+static uint16_t SSD1306_TxLen = 0;  // Transaction length, 0 when the bus is idle
+static uint16_t SSD1306_TxPos = 0;  // Bytes of SSD1306_Tx already clocked out
+
+// Open the transaction, the bytes follow from SSD1306_Continue
+static void SSD1306_Send(uint16_t len) {
     SW_I2C_Start();
     SW_I2C_WriteByte(SSD1306_I2C_ADDR); // Address + Write
-    SW_I2C_WriteByte(0x00);             // Control byte: Command
-    SW_I2C_WriteByte(command);
-    SW_I2C_Stop();
+    SSD1306_TxLen = len;
+    SSD1306_TxPos = 0;
 }
 
-static void SSD1306_WriteData(uint8_t* data, uint16_t size) {
-    SW_I2C_Start();
-    SW_I2C_WriteByte(SSD1306_I2C_ADDR);
-    SW_I2C_WriteByte(0x40); // Control byte: Data
-
-    for(uint16_t i = 0; i < size; i++) {
-        SW_I2C_WriteByte(data[i]);
+// Clock out up to max more bytes, with the STOP after the last one
+static void SSD1306_Continue(uint16_t max) {
+    uint16_t end = SSD1306_TxPos + max;
+    if (end > SSD1306_TxLen) end = SSD1306_TxLen;
+    for (; SSD1306_TxPos < end; SSD1306_TxPos++) {
+        SW_I2C_WriteByte(SSD1306_Tx[SSD1306_TxPos]);
+    }
+    if (SSD1306_TxPos == SSD1306_TxLen) {
+        SW_I2C_Stop();
+        SSD1306_TxLen = 0;
     }
-    SW_I2C_Stop();
+}
+
+// Finish the open transaction in one go, only for Init
+static void SSD1306_Wait(void) {
+    if (SSD1306_TxLen) SSD1306_Continue(SSD1306_TxLen);
+}
+
+uint8_t SSD1306_Busy(void) {
+    return SSD1306_TxLen != 0;
 }
 
 /* =========================================================================
@@ -89,58 +125,121 @@ static void SSD1306_WriteData(uint8_t* data, uint16_t size) {
  * ========================================================================= */
 
 void SSD1306_Init(void) {
-    // Ensure pins are initialized in main.c (GPIO Output Open-Drain recommended)
+    // Init sequence, one command run (control byte 0x00)
+    static const uint8_t init[] = {
+        0x00,
+        0xAE,       // Display Off
+        0x20, 0x00, // Set Memory Addressing Mode: horizontal, the frame is one data run
+        0xC8,       // Set COM Output Scan Direction
+        0x40,       // Set Start Line Address
+        0x81, 0xFF, // Set Contrast Control
+        0xA1,       // Set Segment Re-map
+        0xA6,       // Set Normal/Inverse Display
+        0xA8, 0x3F, // Set Multiplex Ratio
+        0xA4,       // Entire Display GDDRAM/On
+        0xD3, 0x00, // Set Display Offset
+        0xD5, 0xF0, // Set Display Clock Divide Ratio
+        0xD9, 0x22, // Set Pre-charge Period
+        0xDA, 0x12, // Set COM Pins Hardware Configuration
+        0xDB, 0x20, // Set VCOMH Deselect Level
+        0x8D, 0x14, // Charge Pump Setting
+        0xAF,       // Display On
+    };
+
+    // Pins are initialized in main.c (GPIO Output Open-Drain recommended)
 
     HAL_Delay(100); // Boot delay
 
-    // Init sequence
-    SSD1306_WriteCommand(0xAE); // Display Off
-    SSD1306_WriteCommand(0x20); // Set Memory Addressing Mode
-    SSD1306_WriteCommand(0x10); // 00,Horizontal Addressing Mode; 01,Vertical; 10,Page
-    SSD1306_WriteCommand(0xB0); // Set Page Start Address
-    SSD1306_WriteCommand(0xC8); // Set COM Output Scan Direction
-    SSD1306_WriteCommand(0x00); // Set Low Column Address
-    SSD1306_WriteCommand(0x10); // Set High Column Address
-    SSD1306_WriteCommand(0x40); // Set Start Line Address
-    SSD1306_WriteCommand(0x81); // Set Contrast Control
-    SSD1306_WriteCommand(0xFF);
-    SSD1306_WriteCommand(0xA1); // Set Segment Re-map
-    SSD1306_WriteCommand(0xA6); // Set Normal/Inverse Display
-    SSD1306_WriteCommand(0xA8); // Set Multiplex Ratio
-    SSD1306_WriteCommand(0x3F);
-    SSD1306_WriteCommand(0xA4); // Entire Display GDDRAM/On
-    SSD1306_WriteCommand(0xD3); // Set Display Offset
-    SSD1306_WriteCommand(0x00);
-    SSD1306_WriteCommand(0xD5); // Set Display Clock Divide Ratio
-    SSD1306_WriteCommand(0xF0);
-    SSD1306_WriteCommand(0xD9); // Set Pre-charge Period
-    SSD1306_WriteCommand(0x22);
-    SSD1306_WriteCommand(0xDA); // Set COM Pins Hardware Configuration
-    SSD1306_WriteCommand(0x12);
-    SSD1306_WriteCommand(0xDB); // Set VCOMH Deselect Level
-    SSD1306_WriteCommand(0x20);
-    SSD1306_WriteCommand(0x8D); // Charge Pump Setting
-    SSD1306_WriteCommand(0x14);
-    SSD1306_WriteCommand(0xAF); // Display On
+    memcpy(SSD1306_Tx, init, sizeof(init));
+    SSD1306_Send(sizeof(init));
+    SSD1306_Wait();
 
+    // Whatever the panel shows after power up is sent over on the first flush
+    memset(SSD1306_DirtyMin, SSD1306_WIDTH, sizeof(SSD1306_DirtyMin));
+    memset(SSD1306_DirtyMax, 0, sizeof(SSD1306_DirtyMax));
+    SSD1306_Unknown = 0xFF;
     SSD1306_Fill(Black);
     SSD1306_UpdateScreen();
-    SSD1306_Fill(Black);
-    SSD1306_UpdateScreen();
-
+    SSD1306_Wait();
 }
+static inline void SSD1306_MarkDirty(uint8_t page, uint8_t x0, uint8_t x1) {
+    if (x0 < SSD1306_DirtyMin[page]) SSD1306_DirtyMin[page] = x0;
+    if (x1 > SSD1306_DirtyMax[page]) SSD1306_DirtyMax[page] = x1;
+}
+
 void SSD1306_Fill(SSD1306_COLOR color) {
     memset(SSD1306_Buffer, (color == Black) ? 0x00 : 0xFF, sizeof(SSD1306_Buffer));
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        SSD1306_MarkDirty(page, 0, SSD1306_WIDTH - 1);
+    }
 }
 
-void SSD1306_UpdateScreen(void) {
-    for (uint8_t i = 0; i < 8; i++) {
-        SSD1306_WriteCommand(0xB0 + i); // Set Page Start Address
-        SSD1306_WriteCommand(0x00);     // Set Low Column Start Address
-        SSD1306_WriteCommand(0x10);     // Set High Column Start Address
+static uint8_t SSD1306_DirtyPages(void) {
+    uint8_t n = 0;
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        if (SSD1306_DirtyMin[page] <= SSD1306_DirtyMax[page]) n++;
+    }
+    return n;
+}
+
+// Work left for SSD1306_Flush: the dirty pages, plus one while a page is on the bus
+static uint8_t SSD1306_Pending(void) {
+    return SSD1306_DirtyPages() + SSD1306_Busy();
+}
+
+/**
+ * @brief Send one slice: the next SSD1306_SLICE_BYTES of the page on the bus,
+ * or the start of the next dirty page once the bus is free.
+ * Bounded: call it from the main loop, between bursts, until it returns 0.
+ * @return Pages left to send, the one on the bus included.
+ */
+uint8_t SSD1306_Flush(void) {
+    if (SSD1306_Busy()) {
+        SSD1306_Continue(SSD1306_SLICE_BYTES);
+        return SSD1306_Pending();
+    }
+
+    for (uint8_t n = 0; n < SSD1306_PAGES; n++) {
+        uint8_t page = (SSD1306_NextPage + n) % SSD1306_PAGES;
+        uint8_t x0 = SSD1306_DirtyMin[page];
+        uint8_t x1 = SSD1306_DirtyMax[page];
+        if (x0 > x1) continue;
+
+        const uint8_t* buf = &SSD1306_Buffer[page * SSD1306_WIDTH];
+        uint8_t* shown = &SSD1306_Shown[page * SSD1306_WIDTH];
 
-        SSD1306_WriteData(&SSD1306_Buffer[SSD1306_WIDTH * i], SSD1306_WIDTH);
+        // Narrow the touched range down to the bytes that really differ
+        if (!(SSD1306_Unknown & (1 << page))) {
+            while (x0 <= x1 && buf[x0] == shown[x0]) x0++;
+            while (x1 > x0 && buf[x1] == shown[x1]) x1--;
+        }
+        SSD1306_DirtyMin[page] = SSD1306_WIDTH;
+        SSD1306_DirtyMax[page] = 0;
+        SSD1306_Unknown &= ~(1 << page);
+        if (x0 > x1) continue; // Redrawn with the same content
+
+        uint8_t len = x1 - x0 + 1;
+        const uint8_t header[SSD1306_TX_HEADER] = {
+            0x80, 0x21, 0x80, x0, 0x80, x1,     // Column address
+            0x80, 0x22, 0x80, page, 0x80, page, // Page address
+            0x40                                // Data from here on
+        };
+        memcpy(SSD1306_Tx, header, SSD1306_TX_HEADER);
+        memcpy(&SSD1306_Tx[SSD1306_TX_HEADER], &buf[x0], len);
+        memcpy(&shown[x0], &buf[x0], len);
+        SSD1306_Send(SSD1306_TX_HEADER + len);
+        SSD1306_Continue(SSD1306_SLICE_BYTES);
+
+        SSD1306_NextPage = (page + 1) % SSD1306_PAGES;
+        return SSD1306_Pending();
     }
+    return 0;
+}
+
+// Flush every changed span, blocking until the last byte is on the panel
+void SSD1306_UpdateScreen(void) {
+    while (SSD1306_Flush())
+        ;
 }
 
 void SSD1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color) {
@@ -149,6 +248,8 @@ void SSD1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color) {
     x = SSD1306_WIDTH - 1 - x;
     y = SSD1306_HEIGHT - 1 - y;
 
+    SSD1306_MarkDirty(y / 8, x, x);
+
     if (color == White) {
         SSD1306_Buffer[x + (y / 8) * SSD1306_WIDTH] |= (1 << (y % 8));
     } else {
@@ -156,17 +257,51 @@ void SSD1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color) {
     }
 }
 
-void SSD1306_DrawBitmap(uint8_t x, uint8_t y, const unsigned char* bitmap, uint8_t w, uint8_t h, SSD1306_COLOR color) {
-    int16_t byteWidth = (w + 7) / 8; // Bitmap scanline width in bytes
-    uint8_t byte = 0;
+/* Merge one screen column into the buffer. bits and mask are the column in
+ * buffer row order (bit 0 is row 0, the bottom of the screen), starting at
+ * buffer row r0, which may be negative or run past the end: those rows are
+ * clipped by the shift. Only the pages under mask are read and written. */
+static void SSD1306_BlitColumn(int16_t col, int16_t r0, uint64_t bits, uint64_t mask) {
+    if (col < 0 || col >= SSD1306_WIDTH || r0 >= SSD1306_HEIGHT || r0 <= -64) return;
+
+    if (r0 >= 0) {
+        bits <<= r0;
+        mask <<= r0;
+    } else {
+        bits >>= -r0;
+        mask >>= -r0;
+    }
+    if (!mask) return;
+
+    uint8_t first = __builtin_ctzll(mask) / 8;
+    uint8_t last = (63 - __builtin_clzll(mask)) / 8;
+    uint8_t* buf = &SSD1306_Buffer[first * SSD1306_WIDTH + col];
 
-    for(int16_t j=0; j<h; j++, y++) {
-        for(int16_t i=0; i<w; i++) {
-            if(i & 7) byte <<= 1;
-            else      byte = bitmap[j * byteWidth + i / 8];
+    for (uint8_t page = first; page <= last; page++, buf += SSD1306_WIDTH) {
+        uint8_t m = (uint8_t) (mask >> (page * 8));
+        *buf = (*buf & ~m) | ((uint8_t) (bits >> (page * 8)) & m);
+        SSD1306_MarkDirty(page, col, col);
+    }
+}
 
-            if(byte & 0x80) SSD1306_DrawPixel(x+i, y, color);
+// Row-major bitmap, 1 bits are drawn in color and 0 bits are left alone
+void SSD1306_DrawBitmap(uint8_t x, uint8_t y, const unsigned char* bitmap, uint8_t w, uint8_t h, SSD1306_COLOR color) {
+    int16_t byteWidth = (w + 7) / 8; // Bitmap scanline width in bytes
+    // Rows from 64 down are below the screen whatever y is
+    uint8_t rows = h > SSD1306_HEIGHT ? SSD1306_HEIGHT : h;
+
+    for (int16_t i = 0; i < w; i++) {
+        // Gather the column bottom row first, the buffer is upside down
+        const unsigned char* src = &bitmap[i / 8];
+        uint8_t bit = 0x80 >> (i & 7);
+        uint64_t column = 0;
+        for (int16_t j = 0; j < rows; j++, src += byteWidth) {
+            if (*src & bit) column |= 1ULL << (rows - 1 - j);
         }
+        if (!column) continue;
+
+        SSD1306_BlitColumn(SSD1306_WIDTH - 1 - x - i, SSD1306_HEIGHT - y - rows,
+                           color == White ? column : 0, column);
     }
 }
 
@@ -176,8 +311,6 @@ void SSD1306_SetCursor(uint8_t x, uint8_t y) {
 }
 
 void SSD1306_WriteChar(char ch, SSD1306_Font_t font, SSD1306_COLOR color) {
-    uint32_t b;
-
     if (ch == '\n')
     {
         SSD1306.CurrentY += font.height;
@@ -191,16 +324,31 @@ void SSD1306_WriteChar(char ch, SSD1306_Font_t font, SSD1306_COLOR color) {
         return;
     }
 
-
-    // Use font data to draw pixels
-    for (int i = 0; i < font.height; i++) {
-        b = font.data[(ch - 32) * font.height + i];
-        for (int j = 0; j < font.width; j++) {
-            if ((b << j) & 0x8000) {
-                SSD1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i), (SSD1306_COLOR) color);
-            } else {
-                SSD1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i), (SSD1306_COLOR)!color);
+    // The glyph box, background included, as buffer columns and rows
+    int16_t col = SSD1306_WIDTH - SSD1306.CurrentX - font.width;
+    int16_t r0 = SSD1306_HEIGHT - SSD1306.CurrentY - font.height;
+    uint32_t mask = (font.height < 32) ? (1UL << font.height) - 1 : 0xFFFFFFFF;
+
+    if (font.columns) {
+        // Pre-rotated: page p of the glyph is width bytes at p * width
+        uint8_t pages = (font.height + 7) / 8;
+        const uint8_t* glyph = &font.columns[(ch - 32) * pages * font.width];
+        for (uint8_t k = 0; k < font.width; k++, col++) {
+            uint32_t column = 0;
+            for (uint8_t p = 0; p < pages; p++) {
+                column |= (uint32_t) glyph[p * font.width + k] << (p * 8);
+            }
+            SSD1306_BlitColumn(col, r0, color == White ? column : ~column & mask, mask);
+        }
+    } else {
+        // Row tables: bit 15 - j of row i is pixel j, i
+        const uint16_t* rows = &font.data[(ch - 32) * font.height];
+        for (int8_t j = font.width - 1; j >= 0; j--, col++) {
+            uint32_t column = 0;
+            for (uint8_t i = 0; i < font.height; i++) {
+                if ((rows[i] << j) & 0x8000) column |= 1UL << (font.height - 1 - i);
             }
+            SSD1306_BlitColumn(col, r0, color == White ? column : ~column & mask, mask);
         }
     }
 
@@ -14,6 +14,7 @@
 #define SSD1306_HEIGHT 64
 
 // --- Config: GPIO Pins for Soft I2C ---
+// SDA sits on PB10, which has no I2C1 function, so the bus is bit-banged.
 // Change these to match your schematic
 #define SSD1306_SCL_PORT  GPIOB
 #define SSD1306_SCL_PIN   GPIO_PIN_6
@@ -21,6 +22,12 @@
 #define SSD1306_SDA_PORT  GPIOB
 #define SSD1306_SDA_PIN   GPIO_PIN_10
 
+// Bytes clocked out per SSD1306_Flush call. A byte is about 10 us on the bus
+// at 250 MHz, so a slice stays well inside the gap after a burst.
+#ifndef SSD1306_SLICE_BYTES
+#define SSD1306_SLICE_BYTES 16
+#endif
+
 // --- Config: I2C Address ---
 // 0x78 is the default for most modules (0x3C << 1)
 #define SSD1306_I2C_ADDR  0x78
@@ -35,7 +42,8 @@ typedef enum {
 typedef struct {
     const uint8_t width;
     const uint8_t height;
-    const uint16_t *data;
+    const uint16_t *data;    // One uint16_t per row, MSB is the leftmost pixel
+    const uint8_t *columns;  // Same glyphs pre-rotated by ssd1306_fontgen.py, NULL draws from data
 } SSD1306_Font_t;
 
 // Function Prototypes
@@ -50,4 +58,9 @@ void SSD1306_DrawBitmap(uint8_t x, uint8_t y, const unsigned char* bitmap, uint8
 // Simple cursor position control for text
 void SSD1306_SetCursor(uint8_t x, uint8_t y);
 
+// Bounded flush: sends one slice of the changed spans per call, returns the pages left
+uint8_t SSD1306_Flush(void);
+// 1 while a page transaction is open on the bus
+uint8_t SSD1306_Busy(void);
+
 #endif
@@ -9,18 +9,23 @@
 
 #ifdef SSD1306_INCLUDE_FONT_6x8
 extern const SSD1306_Font_t Font_6x8;
+extern const uint8_t Font6x8_Columns[];
 #endif
 #ifdef SSD1306_INCLUDE_FONT_7x10
 extern const SSD1306_Font_t Font_7x10;
+extern const uint8_t Font7x10_Columns[];
 #endif
 #ifdef SSD1306_INCLUDE_FONT_11x18
 extern const SSD1306_Font_t Font_11x18;
+extern const uint8_t Font11x18_Columns[];
 #endif
 #ifdef SSD1306_INCLUDE_FONT_16x26
 extern const SSD1306_Font_t Font_16x26;
+extern const uint8_t Font16x26_Columns[];
 #endif
 #ifdef SSD1306_INCLUDE_FONT_16x24
 extern const SSD1306_Font_t Font_16x24;
+extern const uint8_t Font16x24_Columns[];
 #endif
 #ifdef SSD1306_INCLUDE_FONT_16x15
 /** Generated Roboto Thin 15
@@ -28,6 +33,7 @@ extern const SSD1306_Font_t Font_16x24;
  * @license This font is licensed under the Apache License, Version 2.0.
 */
 extern const SSD1306_Font_t Font_16x15;
+extern const uint8_t Font16x15_Columns[];
 #endif
 
 #endif // __SSD1306_FONTS_H__
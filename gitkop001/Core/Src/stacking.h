@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stdint.h>
+
+#define STACK_MAX_SAMPLES 512
+#define STACK_MAX_DEPTH 256
+
+typedef struct {
+    uint32_t acc[STACK_MAX_SAMPLES]; // Per-sample sums, 4095 * 256 fits with room to spare
+    uint16_t samples;                // Record length
+    uint16_t depth;                  // Records averaged per output curve
+    uint16_t count;                  // Records accumulated so far
+} Stack_t;
+
+/**
+ * @brief Initialize the coherent stacking accumulator.
+ * * @param stack Pointer to the stack object.
+ * @param samples Length of every record, clamped to STACK_MAX_SAMPLES.
+ * @param depth Number of pulse-aligned records averaged into one curve (1 to STACK_MAX_DEPTH).
+ * Averaging N records improves SNR by sqrt(N) at the cost of an N times lower output rate.
+ */
+static inline void Stack_Init(Stack_t *stack, uint16_t samples, uint16_t depth) {
+    if (samples > STACK_MAX_SAMPLES)
+        samples = STACK_MAX_SAMPLES;
+    if (depth < 1)
+        depth = 1;
+    if (depth > STACK_MAX_DEPTH)
+        depth = STACK_MAX_DEPTH;
+
+    stack->samples = samples;
+    stack->depth = depth;
+    stack->count = 0;
+    for (uint16_t i = 0; i < samples; i++)
+        stack->acc[i] = 0;
+}
+
+/**
+ * @brief Add one pulse-aligned record to the accumulator.
+ * Integer adds only, two samples per iteration to keep the per-pulse cost low.
+ * * @param stack Pointer to the stack object.
+ * @param record stack->samples raw ADC samples aligned to the transmit pulse.
+ * @return 1 once depth records have been accumulated and Stack_Average can be called.
+ */
+static inline uint8_t Stack_Add(Stack_t *stack, const uint16_t *record) {
+    uint32_t *acc = stack->acc;
+    uint16_t n = stack->samples;
+    uint16_t i = 0;
+
+    for (; i + 1 < n; i += 2) {
+        acc[i] += record[i];
+        acc[i + 1] += record[i + 1];
+    }
+    if (i < n)
+        acc[i] += record[i];
+
+    stack->count++;
+    return stack->count >= stack->depth;
+}
+
+/**
+ * @brief Emit the averaged curve and start a new stack.
+ * * @param stack Pointer to the stack object.
+ * @param out stack->samples output values.
+ * @param fracBits Extra fractional bits kept in the output (0 = ADC scale, up to 4).
+ * The average carries more than 12 bits of information once depth > 1.
+ */
+static inline void Stack_Average(Stack_t *stack, uint16_t *out, uint8_t fracBits) {
+    uint32_t depth = stack->count ? stack->count : 1;
+    uint32_t half = depth / 2;
+
+    for (uint16_t i = 0; i < stack->samples; i++) {
+        out[i] = (uint16_t) (((stack->acc[i] << fracBits) + half) / depth);
+        stack->acc[i] = 0;
+    }
+    stack->count = 0;
+}
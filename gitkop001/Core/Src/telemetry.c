@@ -0,0 +1,135 @@
+#include "telemetry.h"
+
+#include <string.h>
+
+#include "main.h"
+#include "rice.h"
+#include "uart.h"
+
+static uint32_t pulseSequence = 0;
+static uint8_t pulseFrame[sizeof(Telemetry_Pulse_t) + TELEMETRY_MAX_SAMPLES * 2 + 4];
+static uint8_t pulseEncoded[TELEMETRY_COBS_MAX(sizeof(pulseFrame)) + 1];
+
+static uint32_t recordSequence = 0;
+static uint8_t recordFrame[sizeof(Telemetry_Record_t) + TELEMETRY_MAX_RECORD * 2 + 4];
+static uint8_t recordEncoded[TELEMETRY_COBS_MAX(sizeof(recordFrame)) + 1];
+
+#if PROFILER_ENABLED
+static uint32_t profileSequence = 0;
+static uint8_t profileFrame[sizeof(Telemetry_Profile_t) + TELEMETRY_MAX_STAGES * (sizeof(Telemetry_Stage_t) + PROF_BINS * 4) + 4];
+static uint8_t profileEncoded[TELEMETRY_COBS_MAX(sizeof(profileFrame)) + 1];
+#endif
+
+// Append the CRC32 to the len bytes of frame, COBS encode it into encoded
+// with the 0x00 delimiter and queue it on the UART ring
+static void Telemetry_Send(uint8_t *frame, uint16_t len, uint8_t *encoded) {
+    uint32_t crc = Telemetry_Crc32(frame, len);
+    memcpy(&frame[len], &crc, 4);
+    len += 4;
+
+    uint16_t size = Telemetry_Cobs(frame, len, encoded);
+    encoded[size++] = 0;
+    _write(1, (char *) encoded, size);
+}
+
+/**
+ * @brief Send one pulse frame: the header, the window samples and a CRC32.
+ * * @param header Measurement fields filled in by the caller, the framing
+ *   fields (version to timestampMs, txDropped, reserved) are set here.
+ * @param samples Window before the crossing.
+ * @param count Samples in the window, at most TELEMETRY_MAX_SAMPLES are sent.
+ */
+void Telemetry_SendPulse(Telemetry_Pulse_t *header, const uint16_t *samples, uint16_t count) {
+    if (count > TELEMETRY_MAX_SAMPLES)
+        count = TELEMETRY_MAX_SAMPLES;
+
+    header->version = TELEMETRY_VERSION;
+    header->type = TELEMETRY_PULSE;
+    header->samples = count;
+    header->sequence = pulseSequence++;
+    header->timestampMs = HAL_GetTick();
+    header->txDropped = Uart_TxDropped();
+    header->reserved[0] = header->reserved[1] = header->reserved[2] = 0;
+
+    uint16_t len = sizeof(Telemetry_Pulse_t);
+    memcpy(pulseFrame, header, len);
+    memcpy(&pulseFrame[len], samples, count * 2);
+    len += count * 2;
+    Telemetry_Send(pulseFrame, len, pulseEncoded);
+}
+
+/**
+ * @brief Send one full rate burst record: the header with the first sample,
+ * the Rice coded deltas (or the raw samples when they would not shrink) and a CRC32.
+ * * @param header sampleRateHz, sampleBits and every filled in by the caller.
+ * @param record The burst samples.
+ * @param count Samples in the record, at most TELEMETRY_MAX_RECORD are sent.
+ */
+void Telemetry_SendRecord(Telemetry_Record_t *header, const uint16_t *record, uint16_t count) {
+    if (count > TELEMETRY_MAX_RECORD)
+        count = TELEMETRY_MAX_RECORD;
+
+    uint8_t *payload = &recordFrame[sizeof(Telemetry_Record_t)];
+    uint16_t rawBytes = (count - 1) * 2;
+
+    uint32_t start = DWT->CYCCNT;
+    uint8_t k = Rice_ChooseK(record, count);
+    uint16_t len = Rice_Encode(record, count, k, payload, rawBytes);
+    header->encodeCycles = DWT->CYCCNT - start;
+
+    if (!len) {
+        k = TELEMETRY_RAW;
+        len = rawBytes;
+        memcpy(payload, &record[1], rawBytes);
+    }
+
+    header->version = TELEMETRY_VERSION;
+    header->type = TELEMETRY_RECORD;
+    header->samples = count;
+    header->sequence = recordSequence++;
+    header->timestampMs = HAL_GetTick();
+    header->first = record[0];
+    header->payloadBytes = len;
+    header->riceK = k;
+    header->reserved = 0;
+    header->txDropped = Uart_TxDropped();
+
+    memcpy(recordFrame, header, sizeof(Telemetry_Record_t));
+    Telemetry_Send(recordFrame, sizeof(Telemetry_Record_t) + len, recordEncoded);
+}
+
+#if PROFILER_ENABLED
+/**
+ * @brief Send one profiler dump: the header, then every stage and its histogram.
+ * * @param header intervalMs, coreHz and cycleBudget filled in by the caller.
+ * @param stages The stages, their counters are left alone.
+ * @param count Number of stages, at most TELEMETRY_MAX_STAGES are sent.
+ */
+void Telemetry_SendProfile(Telemetry_Profile_t *header, const Prof_Stage_t *stages, uint8_t count) {
+    if (count > TELEMETRY_MAX_STAGES)
+        count = TELEMETRY_MAX_STAGES;
+
+    header->version = TELEMETRY_VERSION;
+    header->type = TELEMETRY_PROFILE;
+    header->stages = count;
+    header->bins = PROF_BINS;
+    header->sequence = profileSequence++;
+    header->timestampMs = HAL_GetTick();
+
+    uint16_t len = sizeof(Telemetry_Profile_t);
+    memcpy(profileFrame, header, len);
+    for (uint8_t i = 0; i < count; i++) {
+        const Prof_Stage_t *stage = &stages[i];
+        Telemetry_Stage_t *out = (Telemetry_Stage_t *) &profileFrame[len];
+        strncpy(out->name, stage->name, TELEMETRY_STAGE_NAME);
+        out->count = stage->count;
+        out->min = stage->count ? stage->min : 0;
+        out->max = stage->max;
+        out->mean = Prof_Mean(stage);
+        len += sizeof(Telemetry_Stage_t);
+        memcpy(&profileFrame[len], stage->hist, PROF_BINS * 4);
+        len += PROF_BINS * 4;
+    }
+    Telemetry_Send(profileFrame, len, profileEncoded);
+}
+#endif
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "decay.h"
+#include "profiler.h"
+#include "stm32h5xx.h"
+
+// Binary telemetry: every frame is a header, payload and CRC32, COBS encoded
+// and terminated by a 0x00 byte. All fields are little endian. Text lines
+// between frames end with 0x00 as well. A header layout change has to bump
+// TELEMETRY_VERSION and update plotter/telemetry.py, the header sizes are
+// checked below the structs.
+#define TELEMETRY_VERSION 6
+#define TELEMETRY_PULSE 1
+#define TELEMETRY_RECORD 2
+#define TELEMETRY_PROFILE 3
+#define TELEMETRY_MAX_SAMPLES 64
+// Largest burst record and profiler dump the frame buffers in telemetry.c hold
+#define TELEMETRY_MAX_RECORD 512
+#define TELEMETRY_MAX_STAGES 16
+// COBS adds one byte per 254 plus the leading code byte
+#define TELEMETRY_COBS_MAX(len) ((len) + (len) / 254 + 2)
+
+typedef struct __attribute__((packed)) {
+    uint8_t version;          // TELEMETRY_VERSION
+    uint8_t type;             // TELEMETRY_PULSE
+    uint16_t samples;         // uint16_t samples following the header
+    uint32_t sequence;        // Frame counter, gaps mean frames were dropped
+    uint32_t timestampMs;     // HAL tick when the pulse was processed
+    float time;               // Crossing time, us since the period started
+    uint32_t timeNsQ8;        // The same, ns Q24.8, interpolated between samples
+    float value;              // fast - slow
+    float tau;                // Decay time constant, us
+    int32_t fast;             // Q15.16
+    int32_t slow;             // Q15.16
+    int32_t sigma;            // Detector noise estimate, Q15.16
+    int32_t threshold;        // Detector alarm level, Q15.16
+    int32_t alarmRate;        // Alarm onsets per 1000 pulses, Q15.16
+    uint16_t amplitude;       // Decay fit amplitude, ADC counts
+    uint16_t residual;        // Decay fit RMS error, per mille
+    uint32_t blockCycles;
+    uint32_t blockCyclesMax;
+    uint32_t blockCycleBudget;
+    uint32_t blockLatency;    // Cycles from the DMA completing the block to the end of its processing
+    uint32_t blockLatencyMax;
+    uint32_t blocksDropped;
+    uint32_t pulsesDropped;   // Crossing block rewritten by the DMA before it was processed
+    uint32_t pulseSequence;   // TIM1 period of this pulse, the last one of a stack
+    uint32_t pulsesMissed;    // Periods without an AWD crossing
+    uint32_t pulsesOverwritten; // Crossings or bursts replaced before they were processed
+    uint32_t adcOverruns;
+    uint32_t crossingNs[DECAY_LEVELS]; // Decay through awd_low, awd2 and awd3, ns since the period started, 0 if not crossed
+    uint32_t crossingTauNs[DECAY_LEVELS - 1]; // Time constant between neighbouring crossings, 0 when not measurable
+    uint16_t crossingRatio;   // (t3 - t2) / (t2 - t1), Q10
+    uint16_t crossingShape;   // tau23 / tau12, Q10, 1024 for a single exponential
+    uint32_t txDropped;       // UART bytes dropped, including earlier frames
+    uint8_t alarm;
+    uint8_t reserved[3];
+} Telemetry_Pulse_t;
+
+// riceK value of a record sent as plain uint16_t samples
+#define TELEMETRY_RAW 0xFF
+
+typedef struct __attribute__((packed)) {
+    uint8_t version;          // TELEMETRY_VERSION
+    uint8_t type;             // TELEMETRY_RECORD
+    uint16_t samples;         // Samples in the record, including first
+    uint32_t sequence;        // Record counter, gaps mean records were dropped
+    uint32_t timestampMs;     // HAL tick when the record was encoded
+    uint32_t sampleRateHz;    // DMA sample rate of the record
+    uint32_t encodeCycles;    // CPU cycles spent in the encoder for this record
+    uint16_t first;           // First sample, the payload holds the deltas after it
+    uint16_t payloadBytes;    // Bytes between this header and the CRC
+    uint8_t riceK;            // Rice parameter of the deltas, or TELEMETRY_RAW
+    uint8_t sampleBits;
+    uint8_t every;            // Settled bursts per record, the others are not sent
+    uint8_t reserved;
+    uint32_t txDropped;       // UART bytes dropped, including earlier frames
+} Telemetry_Record_t;
+
+// Profiler dump: the header, then stages entries of Telemetry_Stage_t each
+// followed by bins uint32_t histogram counts. Covers the interval since the
+// previous dump, the counters restart after every one.
+typedef struct __attribute__((packed)) {
+    uint8_t version;          // TELEMETRY_VERSION
+    uint8_t type;             // TELEMETRY_PROFILE
+    uint8_t stages;
+    uint8_t bins;             // Bin n counts runs of 2^(n - 1) to 2^n - 1 cycles
+    uint32_t sequence;        // Dump counter, gaps mean dumps were dropped
+    uint32_t timestampMs;     // HAL tick when the dump was sent
+    uint32_t intervalMs;      // Time the counters cover
+    uint32_t coreHz;          // CYCCNT rate
+    uint32_t cycleBudget;     // Cycles available per block, see blockCycleBudget
+} Telemetry_Profile_t;
+
+// Wire sizes of TELEMETRY_VERSION, as plotter/telemetry.py unpacks them
+_Static_assert(sizeof(Telemetry_Pulse_t) == 128, "pulse header changed, bump TELEMETRY_VERSION");
+_Static_assert(sizeof(Telemetry_Record_t) == 32, "record header changed, bump TELEMETRY_VERSION");
+_Static_assert(sizeof(Telemetry_Profile_t) == 24, "profile header changed, bump TELEMETRY_VERSION");
+
+#define TELEMETRY_STAGE_NAME 12
+
+typedef struct __attribute__((packed)) {
+    char name[TELEMETRY_STAGE_NAME]; // Zero padded, not terminated when it fills the field
+    uint32_t count;
+    uint32_t min;             // Cycles, 0 when count is 0
+    uint32_t max;
+    uint32_t mean;
+} Telemetry_Stage_t;
+
+#ifdef CRC
+/**
+ * @brief Configure the CRC unit for the zlib/Ethernet CRC32.
+ * Polynomial 0x04C11DB7 (reset default), bit reversed in and out, the final
+ * inversion is done in Telemetry_Crc32.
+ */
+static inline void Telemetry_CrcInit(void) {
+    __HAL_RCC_CRC_CLK_ENABLE();
+    CRC->INIT = 0xFFFFFFFF;
+    CRC->CR = CRC_CR_REV_IN_0 | CRC_CR_REV_OUT;
+}
+
+static inline uint32_t Telemetry_Crc32(const uint8_t *data, uint16_t len) {
+    CRC->CR |= CRC_CR_RESET;
+    for (uint16_t i = 0; i < len; i++)
+        *(volatile uint8_t *) &CRC->DR = data[i];
+    return ~CRC->DR;
+}
+#else
+// No CRC unit (the host build): the same CRC32, one bit at a time
+static inline void Telemetry_CrcInit(void) {
+}
+
+static inline uint32_t Telemetry_Crc32(const uint8_t *data, uint16_t len) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint16_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+#endif
+
+/**
+ * @brief COBS encode len bytes, the output contains no 0x00.
+ * * @param out At least TELEMETRY_COBS_MAX(len) bytes.
+ * @return Encoded length, without the frame delimiter.
+ */
+static inline uint16_t Telemetry_Cobs(const uint8_t *in, uint16_t len, uint8_t *out) {
+    uint16_t code = 0;
+    uint16_t o = 1;
+    uint8_t run = 1;
+
+    for (uint16_t i = 0; i < len; i++) {
+        if (in[i] == 0) {
+            out[code] = run;
+            code = o++;
+            run = 1;
+            continue;
+        }
+        out[o++] = in[i];
+        if (++run == 0xFF) {
+            out[code] = run;
+            code = o++;
+            run = 1;
+        }
+    }
+    out[code] = run;
+    return o;
+}
+
+void Telemetry_SendPulse(Telemetry_Pulse_t *header, const uint16_t *samples, uint16_t count);
+void Telemetry_SendRecord(Telemetry_Record_t *header, const uint16_t *record, uint16_t count);
+#if PROFILER_ENABLED
+void Telemetry_SendProfile(Telemetry_Profile_t *header, const Prof_Stage_t *stages, uint8_t count);
+#endif
@@ -0,0 +1,78 @@
+#include "uart.h"
+
+#include <string.h>
+
+#include "GitKop.h"
+
+static UART_HandleTypeDef *txUart;
+
+// Single producer (_write from the main loop), single consumer (TX complete
+// interrupt), so head and tail each have one writer and no lock is needed.
+// A write that does not fit is dropped whole and counted in txDropped.
+DMA_BUFFER static uint8_t txRing[UART_TX_RING_SIZE];
+volatile static uint16_t txHead = 0;
+volatile static uint16_t txTail = 0;
+volatile static uint16_t txLen = 0; // Bytes handed to the DMA, 0 while it is idle
+static uint32_t txDropped = 0;
+
+// Send the contiguous run at the tail, the wrapped part follows on completion
+static void Uart_Kick(void) {
+    uint16_t head = txHead;
+    uint16_t tail = txTail;
+    if (head == tail) {
+        txLen = 0;
+        return;
+    }
+
+    uint16_t len = head > tail ? head - tail : UART_TX_RING_SIZE - tail;
+    txLen = len;
+    HAL_UART_Transmit_DMA(txUart, &txRing[tail], len);
+}
+
+/**
+ * @brief Take over the TX side of a UART, call before the first write.
+ * * @param huart UART with its TX DMA channel linked.
+ */
+void Uart_Init(UART_HandleTypeDef *huart) {
+    txUart = huart;
+}
+
+/**
+ * @brief Hand the next part of the ring to the DMA, from HAL_UART_TxCpltCallback.
+ * * @param huart The UART that finished, others are ignored.
+ */
+void Uart_TxCplt(UART_HandleTypeDef *huart) {
+    if (huart != txUart)
+        return;
+    txTail = (txTail + txLen) & (UART_TX_RING_SIZE - 1);
+    Uart_Kick();
+}
+
+uint32_t Uart_TxDropped(void) {
+    return txDropped;
+}
+
+int _write(int file, char *ptr, int len) {
+    (void) file;
+    uint16_t head = txHead;
+    uint16_t used = (head - txTail) & (UART_TX_RING_SIZE - 1);
+    if (len > UART_TX_RING_SIZE - 1 - used) {
+        txDropped += len;
+        return len;
+    }
+
+    uint16_t first = UART_TX_RING_SIZE - head;
+    if (first > len)
+        first = len;
+    memcpy(&txRing[head], ptr, first);
+    memcpy(txRing, ptr + first, len - first);
+
+    // Data must be in place before the consumer can see the new head
+    __DMB();
+    txHead = (head + len) & (UART_TX_RING_SIZE - 1);
+
+    // The DMA is idle, so the TX complete interrupt cannot race this
+    if (txLen == 0)
+        Uart_Kick();
+    return len;
+}
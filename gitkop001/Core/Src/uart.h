@@ -0,0 +1,19 @@
+#ifndef UART_H
+#define UART_H
+
+#include <stdint.h>
+
+#include "usart.h"
+
+// printf and the telemetry frames only copy into a TX ring, the UART TX DMA
+// drains it in the background. _write queues a write whole or drops it.
+
+#define UART_TX_RING_SIZE 4096
+
+void Uart_Init(UART_HandleTypeDef *huart);
+void Uart_TxCplt(UART_HandleTypeDef *huart);
+// Bytes dropped so far because the ring was full
+uint32_t Uart_TxDropped(void);
+int _write(int file, char *ptr, int len);
+
+#endif
@@ -0,0 +1,481 @@
+#include "bench.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "GitKop.h"
+#include "command.h"
+#include "detector.h"
+#include "filters.h"
+#include "telemetry.h"
+
+// Pulses remembered for labelling, a frame is never this far behind its pulse
+#define BENCH_RING 65536
+#define BENCH_FRAME_MAX 1024
+#define BENCH_ROC_POINTS 101
+
+// What Handle_Sample in GitKop.c runs with: the GitKop.h defaults, then
+// the run's set commands for the ones the command channel can change
+static struct {
+    float slowAlpha;
+    float fastAlpha;
+    float kOn;
+    float kOff;
+} benchParams;
+
+typedef struct {
+    uint32_t onset;      // First pulse with the target coupled at all
+    uint32_t end;        // Last pulse of the pass window, UINT32_MAX while it is open
+    double seconds;
+} Bench_Pass_t;
+
+static struct {
+    uint64_t settle;
+    uint32_t pulse;
+    float scale[BENCH_RING];
+    uint8_t near[BENCH_RING];
+    double seconds[BENCH_RING];
+
+    Bench_Obs_t *obs;
+    uint32_t obsCount;
+    uint32_t obsSize;
+    Bench_Pass_t *passes;
+    uint32_t passCount;
+    uint32_t passSize;
+    uint8_t passOpen;
+
+    uint8_t frame[BENCH_FRAME_MAX];
+    uint16_t frameLen;
+    uint8_t frameOverflow;
+    uint32_t frames;
+    uint32_t badFrames;
+    uint32_t framesLost;
+    uint32_t sequence;
+    uint32_t txDropped;
+} bench;
+
+// ---- Detectors ----
+
+// The firmware itself: its alarm flag, and its fast - slow before the
+// CFAR stage as the score
+static void Bench_FirmwareInit(void *state, uint16_t depth) {
+    (void) state;
+    (void) depth;
+}
+
+static float Bench_FirmwareUpdate(void *state, const Bench_Obs_t *obs, uint8_t *alarm) {
+    (void) state;
+    *alarm = obs->alarm;
+    return obs->value;
+}
+
+// Handle_Sample on the host: fast and slow EMAs of a pulse feature, the
+// CFAR detector on their difference. The score is the difference in sigmas.
+typedef struct {
+    EMA_t slow;
+    EMA_t fast;
+    Detector_t detector;
+    uint16_t depth;
+    uint8_t seeded;
+} Bench_Ema_t;
+
+static float Bench_ScaleAlpha(float alpha, uint16_t depth) {
+    return depth <= 1 ? alpha : 1.0f - powf(1.0f - alpha, depth);
+}
+
+static void Bench_EmaInit(void *state, uint16_t depth) {
+    Bench_Ema_t *ema = state;
+    ema->depth = depth;
+    ema->seeded = 0;
+}
+
+static float Bench_EmaUpdate(Bench_Ema_t *ema, int32_t x, uint8_t *alarm) {
+    if (!ema->seeded) {
+        EMA_Init(&ema->slow, Filt_Q31(Bench_ScaleAlpha(benchParams.slowAlpha, ema->depth)), x);
+        EMA_Init(&ema->fast, Filt_Q31(Bench_ScaleAlpha(benchParams.fastAlpha, ema->depth)), x);
+        Detector_Init(&ema->detector, Filt_Q31(Bench_ScaleAlpha(DETECT_NOISE_ALPHA, ema->depth)),
+                      FILT_FROM_FLOAT(benchParams.kOn), FILT_FROM_FLOAT(benchParams.kOff),
+                      FILT_FROM_FLOAT(DETECT_SIGMA_MIN_US), ema->depth);
+        ema->seeded = 1;
+    } else {
+        EMA_Update(&ema->fast, x);
+        EMA_Update(&ema->slow, x);
+    }
+
+    int32_t difference = ema->fast.out - ema->slow.out;
+    float score = (float) (difference - ema->detector.mean.out) / (float) ema->detector.sigma;
+    *alarm = Detector_Update(&ema->detector, difference);
+    return score;
+}
+
+// The firmware input: the interpolated crossing time in microseconds, Q15.16
+static float Bench_EmaTimeUpdate(void *state, const Bench_Obs_t *obs, uint8_t *alarm) {
+    return Bench_EmaUpdate(state, (int32_t) (((uint64_t) obs->timeNsQ8 << 8) / 1000), alarm);
+}
+
+// The decay fit time constant in nanoseconds instead
+static float Bench_EmaTauUpdate(void *state, const Bench_Obs_t *obs, uint8_t *alarm) {
+    return Bench_EmaUpdate(state, FILT_FROM_FLOAT(obs->tau * 1000.0f), alarm);
+}
+
+// The decay shape from the three watchdog levels, in percent. A target lifts
+// the upper part of the decay more than the lower, so the shape drops, and
+// the detector only alarms upwards.
+static float Bench_EmaShapeUpdate(void *state, const Bench_Obs_t *obs, uint8_t *alarm) {
+    return Bench_EmaUpdate(state, FILT_FROM_FLOAT(obs->shape * (-100.0f / 1024.0f)), alarm);
+}
+
+// Add new detectors here, each one is run over the same records
+static const Bench_Detector_t detectors[] = {
+    { "firmware", 0, Bench_FirmwareInit, Bench_FirmwareUpdate },
+    { "ema_time", sizeof(Bench_Ema_t), Bench_EmaInit, Bench_EmaTimeUpdate },
+    { "ema_tau", sizeof(Bench_Ema_t), Bench_EmaInit, Bench_EmaTauUpdate },
+    { "ema_shape", sizeof(Bench_Ema_t), Bench_EmaInit, Bench_EmaShapeUpdate },
+};
+#define BENCH_DETECTORS (sizeof(detectors) / sizeof(detectors[0]))
+
+// ---- Collection ----
+
+void Bench_Init(uint64_t settle) {
+    memset(&bench, 0, sizeof(bench));
+    bench.settle = settle;
+    bench.sequence = UINT32_MAX;
+}
+
+void Bench_Pulse(uint32_t pulse, double seconds, double scale, uint8_t near) {
+    bench.pulse = pulse;
+    bench.scale[pulse % BENCH_RING] = (float) scale;
+    bench.near[pulse % BENCH_RING] = near;
+    bench.seconds[pulse % BENCH_RING] = seconds;
+
+    if (scale > 0.0 && !bench.passOpen) {
+        if (bench.passCount == bench.passSize) {
+            bench.passSize = bench.passSize ? bench.passSize * 2 : 64;
+            bench.passes = realloc(bench.passes, bench.passSize * sizeof(Bench_Pass_t));
+        }
+        bench.passes[bench.passCount++] = (Bench_Pass_t) { pulse, UINT32_MAX, seconds };
+        bench.passOpen = 1;
+    } else if (!near && bench.passOpen) {
+        bench.passes[bench.passCount - 1].end = pulse - 1;
+        bench.passOpen = 0;
+    }
+}
+
+static int32_t Bench_Cobs(const uint8_t *in, uint16_t len, uint8_t *out) {
+    uint16_t i = 0;
+    uint16_t o = 0;
+    while (i < len) {
+        uint8_t code = in[i++];
+        if (!code)
+            return -1;
+        for (uint8_t j = 1; j < code; j++) {
+            if (i >= len)
+                return -1;
+            out[o++] = in[i++];
+        }
+        if (code < 0xFF && i < len)
+            out[o++] = 0;
+    }
+    return o;
+}
+
+static void Bench_Frame(void) {
+    static uint8_t decoded[BENCH_FRAME_MAX];
+    int32_t len = Bench_Cobs(bench.frame, bench.frameLen, decoded);
+    if (len < 6)
+        return; // Text lines and command replies end up here
+    uint32_t crc;
+    memcpy(&crc, &decoded[len - 4], 4);
+    if (Telemetry_Crc32(decoded, (uint16_t) (len - 4)) != crc) {
+        bench.badFrames++;
+        return;
+    }
+    if (decoded[0] != TELEMETRY_VERSION || decoded[1] != TELEMETRY_PULSE ||
+        (size_t) len < sizeof(Telemetry_Pulse_t) + 4)
+        return;
+
+    Telemetry_Pulse_t frame;
+    memcpy(&frame, decoded, sizeof(frame));
+    bench.frames++;
+    if (bench.sequence != UINT32_MAX)
+        bench.framesLost += frame.sequence - bench.sequence - 1;
+    bench.sequence = frame.sequence;
+    bench.txDropped = frame.txDropped;
+
+    if (bench.obsCount == bench.obsSize) {
+        bench.obsSize = bench.obsSize ? bench.obsSize * 2 : 1024;
+        bench.obs = realloc(bench.obs, bench.obsSize * sizeof(Bench_Obs_t));
+    }
+    Bench_Obs_t *obs = &bench.obs[bench.obsCount++];
+    obs->pulse = frame.pulseSequence;
+    obs->time = frame.time;
+    obs->timeNsQ8 = frame.timeNsQ8;
+    obs->tau = frame.tau;
+    obs->value = frame.value;
+    obs->amplitude = frame.amplitude;
+    obs->shape = frame.crossingShape;
+    obs->alarm = frame.alarm;
+    obs->label = -1;
+    obs->seconds = 0.0;
+    if (bench.pulse - obs->pulse < BENCH_RING) {
+        uint32_t slot = obs->pulse % BENCH_RING;
+        float scale = bench.scale[slot];
+        obs->label = scale >= 0.5f ? 1 : !bench.near[slot] ? 0 : -1;
+        obs->seconds = bench.seconds[slot];
+    }
+}
+
+// USART1 bytes, frames are COBS encoded and end with 0x00
+void Bench_Uart(const uint8_t *data, uint16_t size) {
+    for (uint16_t i = 0; i < size; i++) {
+        if (data[i] == 0) {
+            if (!bench.frameOverflow)
+                Bench_Frame();
+            bench.frameLen = 0;
+            bench.frameOverflow = 0;
+        } else if (bench.frameLen < BENCH_FRAME_MAX) {
+            bench.frame[bench.frameLen++] = data[i];
+        } else {
+            bench.frameOverflow = 1;
+        }
+    }
+}
+
+// ---- Evaluation ----
+
+// The commands reach the firmware in order, the last set of a name wins
+static void Bench_Params(const Sim_Config_t *config) {
+    benchParams.slowAlpha = SLOW_ALPHA;
+    benchParams.fastAlpha = FAST_ALPHA;
+    benchParams.kOn = DETECT_K_ON;
+    benchParams.kOff = DETECT_K_OFF;
+    for (uint16_t i = 0; i < config->commandCount; i++) {
+        char name[COMMAND_LINE_MAX];
+        float value;
+        if (sscanf(config->commands[i], "set %63s %f", name, &value) != 2)
+            continue;
+        if (strcmp(name, "alpha_slow") == 0)
+            benchParams.slowAlpha = value;
+        else if (strcmp(name, "alpha_fast") == 0)
+            benchParams.fastAlpha = value;
+        else if (strcmp(name, "k_on") == 0)
+            benchParams.kOn = value;
+        else if (strcmp(name, "k_off") == 0)
+            benchParams.kOff = value;
+    }
+}
+
+// JSON string with quotes, backslashes and control characters escaped
+static void Bench_String(FILE *out, const char *s) {
+    fputc('"', out);
+    for (; *s; s++) {
+        unsigned char c = (unsigned char) *s;
+        if (c == '"' || c == '\\')
+            fprintf(out, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(out, "\\u%04x", c);
+        else
+            fputc(c, out);
+    }
+    fputc('"', out);
+}
+
+typedef struct {
+    float score;
+    int8_t label;
+} Bench_Score_t;
+
+static int Bench_ByScore(const void *a, const void *b) {
+    float sa = ((const Bench_Score_t *) a)->score;
+    float sb = ((const Bench_Score_t *) b)->score;
+    return sa < sb ? 1 : sa > sb ? -1 : 0;
+}
+
+static double Bench_Seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Smallest pulse step between records, drops only make it larger
+static uint16_t Bench_Depth(void) {
+    uint32_t depth = UINT32_MAX;
+    for (uint32_t i = 1; i < bench.obsCount && i < 64; i++) {
+        uint32_t step = bench.obs[i].pulse - bench.obs[i - 1].pulse;
+        if (step && step < depth)
+            depth = step;
+    }
+    return depth == UINT32_MAX || depth > 65535 ? 1 : (uint16_t) depth;
+}
+
+static void Bench_Detector(FILE *out, const Bench_Detector_t *det, uint16_t depth, uint8_t last) {
+    uint32_t count = bench.obsCount;
+    float *score = malloc(sizeof(float) * (count ? count : 1));
+    uint8_t *alarm = malloc(count ? count : 1);
+    void *state = det->stateSize ? calloc(1, det->stateSize) : NULL;
+
+    det->init(state, depth);
+    double start = Bench_Seconds();
+    for (uint32_t i = 0; i < count; i++)
+        score[i] = det->update(state, &bench.obs[i], &alarm[i]);
+    double elapsed = Bench_Seconds() - start;
+    free(state);
+
+    // Operating point and ROC over the labelled records after the settling time
+    Bench_Score_t *scored = malloc(sizeof(Bench_Score_t) * (count ? count : 1));
+    uint32_t n = 0, positives = 0, negatives = 0, hits = 0, falseAlarms = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        const Bench_Obs_t *obs = &bench.obs[i];
+        if (obs->pulse < bench.settle || obs->label < 0 || !isfinite(score[i]))
+            continue;
+        scored[n++] = (Bench_Score_t) { score[i], obs->label };
+        if (obs->label) {
+            positives++;
+            hits += alarm[i];
+        } else {
+            negatives++;
+            falseAlarms += alarm[i];
+        }
+    }
+    qsort(scored, n, sizeof(Bench_Score_t), Bench_ByScore);
+
+    // One ROC point per distinct threshold, the AUC by trapezoids between them
+    double *pfa = malloc(sizeof(double) * (n + 1));
+    double *pd = malloc(sizeof(double) * (n + 1));
+    uint32_t points = 0;
+    double auc = 0.0;
+    pfa[points] = 0.0;
+    pd[points++] = 0.0;
+    if (positives && negatives) {
+        uint32_t tp = 0, fp = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            if (scored[i].label)
+                tp++;
+            else
+                fp++;
+            if (i + 1 < n && scored[i + 1].score == scored[i].score)
+                continue;
+            pfa[points] = (double) fp / negatives;
+            pd[points] = (double) tp / positives;
+            auc += (pfa[points] - pfa[points - 1]) * (pd[points] + pd[points - 1]) / 2;
+            points++;
+        }
+    }
+
+    // Latency from the first coupled pulse of a pass to the first alarm inside its window
+    uint32_t passes = 0, detected = 0, maxPulses = 0;
+    double sumPulses = 0.0, sumMs = 0.0, maxMs = 0.0;
+    uint32_t o = 0;
+    for (uint32_t p = 0; p < bench.passCount; p++) {
+        const Bench_Pass_t *pass = &bench.passes[p];
+        if (pass->onset < bench.settle || pass->end == UINT32_MAX)
+            continue;
+        passes++;
+        while (o < count && bench.obs[o].pulse < pass->onset)
+            o++;
+        for (uint32_t i = o; i < count && bench.obs[i].pulse <= pass->end; i++) {
+            if (!alarm[i])
+                continue;
+            uint32_t pulses = bench.obs[i].pulse - pass->onset;
+            double ms = (bench.obs[i].seconds - pass->seconds) * 1e3;
+            detected++;
+            sumPulses += pulses;
+            sumMs += ms;
+            if (pulses > maxPulses)
+                maxPulses = pulses;
+            if (ms > maxMs)
+                maxMs = ms;
+            break;
+        }
+    }
+
+    fprintf(out, "    {\n");
+    fprintf(out, "      \"name\": ");
+    Bench_String(out, det->name);
+    fprintf(out, ",\n");
+    fprintf(out, "      \"records\": %u,\n", n);
+    fprintf(out, "      \"positives\": %u,\n", positives);
+    fprintf(out, "      \"negatives\": %u,\n", negatives);
+    if (positives && negatives)
+        fprintf(out, "      \"auc\": %.6f,\n", auc);
+    else
+        fprintf(out, "      \"auc\": null,\n");
+    fprintf(out, "      \"pd\": %.6f,\n", positives ? (double) hits / positives : 0.0);
+    fprintf(out, "      \"pfa\": %.6f,\n", negatives ? (double) falseAlarms / negatives : 0.0);
+    fprintf(out, "      \"latency\": { \"passes\": %u, \"detected\": %u, ", passes, detected);
+    if (detected)
+        fprintf(out, "\"mean_pulses\": %.2f, \"max_pulses\": %u, \"mean_ms\": %.3f, \"max_ms\": %.3f },\n",
+                sumPulses / detected, maxPulses, sumMs / detected, maxMs);
+    else
+        fprintf(out, "\"mean_pulses\": null, \"max_pulses\": null, \"mean_ms\": null, \"max_ms\": null },\n");
+    // Host time, only for comparing the detectors with each other. The target
+    // cost is in the firmware's profiler dump, the simulator does not clock it.
+    fprintf(out, "      \"host_ns_per_record\": %.2f,\n", count ? elapsed * 1e9 / count : 0.0);
+
+    // At most BENCH_ROC_POINTS points, evenly picked, both ends kept
+    fprintf(out, "      \"roc\": [");
+    uint32_t emit = points < BENCH_ROC_POINTS ? points : BENCH_ROC_POINTS;
+    for (uint32_t k = 0; k < emit; k++) {
+        uint32_t i = emit > 1 ? (uint32_t) ((uint64_t) k * (points - 1) / (emit - 1)) : 0;
+        fprintf(out, "%s[%.6f, %.6f]", k ? ", " : "", pfa[i], pd[i]);
+    }
+    fprintf(out, "]\n");
+    fprintf(out, "    }%s\n", last ? "" : ",");
+
+    free(pfa);
+    free(pd);
+    free(scored);
+    free(alarm);
+    free(score);
+}
+
+/**
+ * @brief Run every detector over the collected records and write the results.
+ * * @param out JSON destination.
+ * @param config The simulator configuration of the run.
+ * @param stats The simulator statistics at the end of the run.
+ * @param wall Host seconds the run took.
+ */
+void Bench_Write(FILE *out, const Sim_Config_t *config, const Sim_Stats_t *stats, double wall) {
+    uint16_t depth = Bench_Depth();
+    Bench_Params(config);
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"run\": {\n");
+    fprintf(out, "    \"source\": \"%s\",\n", config->replay ? "replay" : "coil");
+    fprintf(out, "    \"pulses\": %llu,\n", (unsigned long long) stats->pulses);
+    fprintf(out, "    \"settle\": %llu,\n", (unsigned long long) config->settle);
+    fprintf(out, "    \"seed\": %llu,\n", (unsigned long long) config->seed);
+    fprintf(out, "    \"target_amp_mv\": %.4f,\n", config->coil.targetAmp * 1e3);
+    fprintf(out, "    \"target_tau_us\": %.3f,\n", config->coil.targetTau * 1e6);
+    fprintf(out, "    \"noise_uv\": %.3f,\n", config->coil.noise * 1e6);
+    fprintf(out, "    \"adc_noise_lsb\": %.3f,\n", config->adcNoise);
+    fprintf(out, "    \"sweep_ms\": %.3f,\n", config->sweepPeriod * 1e3);
+    fprintf(out, "    \"sweep_width_ms\": %.3f,\n", config->sweepWidth * 1e3);
+    fprintf(out, "    \"commands\": [");
+    for (uint16_t i = 0; i < config->commandCount; i++) {
+        fprintf(out, "%s", i ? ", " : "");
+        Bench_String(out, config->commands[i]);
+    }
+    fprintf(out, "],\n");
+    fprintf(out, "    \"sim_seconds\": %.6f,\n", stats->seconds);
+    fprintf(out, "    \"wall_seconds\": %.6f,\n", wall);
+    fprintf(out, "    \"pulses_per_second\": %.1f,\n", wall > 0 ? stats->pulses / wall : 0.0);
+    fprintf(out, "    \"realtime_factor\": %.3f,\n", wall > 0 ? stats->seconds / wall : 0.0);
+    fprintf(out, "    \"firmware_host_seconds\": %.6f\n", stats->firmwareSeconds);
+    fprintf(out, "  },\n");
+    fprintf(out, "  \"stream\": {\n");
+    fprintf(out, "    \"frames\": %u,\n", bench.frames);
+    fprintf(out, "    \"frames_lost\": %u,\n", bench.framesLost);
+    fprintf(out, "    \"bad_frames\": %u,\n", bench.badFrames);
+    fprintf(out, "    \"tx_dropped_bytes\": %u,\n", bench.txDropped);
+    fprintf(out, "    \"pulses_per_record\": %u\n", depth);
+    fprintf(out, "  },\n");
+    fprintf(out, "  \"detectors\": [\n");
+    for (uint32_t i = 0; i < BENCH_DETECTORS; i++)
+        Bench_Detector(out, &detectors[i], depth, i + 1 == BENCH_DETECTORS);
+    fprintf(out, "  ]\n");
+    fprintf(out, "}\n");
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "sim.h"
+
+// Detection benchmark over a simulated or replayed run. The firmware's own
+// pulse frames (debug=1) are picked out of the USART1 stream, every one is
+// labelled with the target coupling the simulator gave that TIM1 period,
+// and after the run each detector below is played over the same stream.
+
+// One processed record as the firmware reports it
+typedef struct {
+    uint32_t pulse;      // TIM1 period, the last one of a stack
+    double seconds;      // Simulated start of that period
+    float time;          // Crossing time, us
+    uint32_t timeNsQ8;   // The same as the firmware filters it, ns Q24.8
+    float tau;           // Decay time constant, us
+    float value;         // Firmware fast - slow
+    uint16_t amplitude;  // Decay fit amplitude, ADC counts
+    uint16_t shape;      // tau23 / tau12 from the watchdog level crossings, Q10
+    uint8_t alarm;       // Firmware detector
+    int8_t label;        // 1 target at least half coupled, 0 no target near, -1 in between
+} Bench_Obs_t;
+
+// A detector under test. update sees the records in order and returns a
+// score, higher meaning more target-like, which the ROC sweeps a threshold
+// over; alarm is the detector's own decision at its operating point.
+typedef struct {
+    const char *name;
+    size_t stateSize;
+    void (*init)(void *state, uint16_t depth);  // depth: pulses behind every record
+    float (*update)(void *state, const Bench_Obs_t *obs, uint8_t *alarm);
+} Bench_Detector_t;
+
+void Bench_Init(uint64_t settle);
+void Bench_Pulse(uint32_t pulse, double seconds, double scale, uint8_t near);
+void Bench_Uart(const uint8_t *data, uint16_t size);
+void Bench_Write(FILE *out, const Sim_Config_t *config, const Sim_Stats_t *stats, double wall);
@@ -0,0 +1,131 @@
+#include "coil.h"
+
+#include <math.h>
+
+void Coil_Defaults(Coil_Params_t *params) {
+    params->vbat = 7.4;
+    params->l = 400e-6;
+    params->rSeries = 2.0;
+    params->rDamp = 400.0;
+    params->c = 625e-12;
+    params->clamp = 0.7;
+    params->gain = 1000.0 * 0.33;
+    params->vBase = 1.0;
+    params->vRef = 3.3;
+    params->noise = 50e-6;
+    params->targetAmp = 0.0;
+    params->targetTau = 20e-6;
+}
+
+void Coil_Init(Coil_t *coil, const Coil_Params_t *params, uint64_t seed) {
+    coil->p = *params;
+    coil->rng = seed ? seed : 1;
+    Coil_Pulse(coil, 15e-6, 0.0);
+}
+
+// xorshift64*, the simulator has to be reproducible from the seed alone
+static double Coil_Uniform(Coil_t *coil) {
+    coil->rng ^= coil->rng >> 12;
+    coil->rng ^= coil->rng << 25;
+    coil->rng ^= coil->rng >> 27;
+    return (double) ((coil->rng * 0x2545F4914F6CDD1DULL) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Sum of four uniforms, variance 4 / 12: close enough to a gaussian for
+// front end noise and much cheaper than Box-Muller at 4 MS/s
+double Coil_Gauss(Coil_t *coil) {
+    double sum = Coil_Uniform(coil) + Coil_Uniform(coil) + Coil_Uniform(coil) + Coil_Uniform(coil);
+    return (sum - 2.0) * 1.7320508075688772;
+}
+
+/**
+ * @brief Set up the response of the next pulse.
+ * * @param coil Pointer to the model.
+ * @param tOn Transmit pulse length (TIM1 CCR3), s.
+ * @param targetScale Coupling of the target for this pulse, 0 is no target.
+ */
+void Coil_Pulse(Coil_t *coil, double tOn, double targetScale) {
+    const Coil_Params_t *p = &coil->p;
+    coil->tOn = tOn;
+
+    // Current ramp through the winding resistance, the coil keeps it at turn-off
+    double i0 = p->vbat / p->rSeries * (1.0 - exp(-tOn * p->rSeries / p->l));
+
+    // Parallel RLC, v(0) = 0 and C dv/dt(0) = i0
+    double alpha = 1.0 / (2.0 * p->rDamp * p->c);
+    double w0 = 1.0 / sqrt(p->l * p->c);
+    double slowest;
+    coil->alpha = alpha;
+    if (alpha > w0 * 1.0001) {
+        double root = sqrt(alpha * alpha - w0 * w0);
+        coil->s1 = -alpha + root;
+        coil->s2 = -alpha - root;
+        coil->a = i0 / p->c / (coil->s1 - coil->s2);
+        coil->damping = 0;
+        slowest = -coil->s1;
+    } else if (alpha >= w0 * 0.9999) {
+        coil->a = i0 / p->c;
+        coil->damping = 1;
+        slowest = alpha;
+    } else {
+        coil->wd = sqrt(w0 * w0 - alpha * alpha);
+        coil->a = i0 / p->c / coil->wd;
+        coil->damping = 2;
+        slowest = alpha;
+    }
+
+    // The eddy currents build up with the target time constant during the pulse
+    coil->target = p->targetAmp * targetScale * (1.0 - exp(-tOn / p->targetTau));
+
+    // Where the larger of the two decays drops a decade below the noise floor
+    double floor = p->noise > 1e-9 ? p->noise * 0.1 : 1e-9;
+    double spanCoil = (log(fabs(coil->a) / floor + 1.0) + 10.0) / slowest;
+    double spanTarget = coil->target > floor ? log(coil->target / floor) * p->targetTau : 0.0;
+    coil->span = spanCoil > spanTarget ? spanCoil : spanTarget;
+}
+
+/**
+ * @brief Voltage at the ADC pin.
+ * While the MOSFET conducts the receiver sits at the upper rail, the AWD
+ * is re-armed at the update event and only sees the decay crossing.
+ * * @param coil Pointer to the model.
+ * @param t Time since the pulse period started, s.
+ * @return Volts, clipped to the ADC input range.
+ */
+double Coil_Volts(Coil_t *coil, double t) {
+    const Coil_Params_t *p = &coil->p;
+    // The ring-down starts from 0 V at turn-off, but the input is still
+    // saturated there. ADC holds fall on the TIM1 tick grid, so a sample can
+    // land exactly on that instant.
+    if (t <= coil->tOn)
+        return p->vRef;
+
+    double after = t - coil->tOn;
+    double v = 0.0;
+    if (after < coil->span) {
+        switch (coil->damping) {
+        case 0:
+            v = coil->a * (exp(coil->s1 * after) - exp(coil->s2 * after));
+            break;
+        case 1:
+            v = coil->a * after * exp(-coil->alpha * after);
+            break;
+        default:
+            v = coil->a * exp(-coil->alpha * after) * sin(coil->wd * after);
+            break;
+        }
+        v += coil->target * exp(-after / p->targetTau);
+    }
+    v += p->noise * Coil_Gauss(coil);
+
+    if (v > p->clamp)
+        v = p->clamp;
+    if (v < -p->clamp)
+        v = -p->clamp;
+    double out = p->vBase + p->gain * v;
+    if (out < 0.0)
+        return 0.0;
+    if (out > p->vRef)
+        return p->vRef;
+    return out;
+}
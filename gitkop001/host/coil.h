@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+
+// Analog front end seen by the ADC pin, after simulations/GitKop.asc:
+// BAT charges L1 through the MOSFET for the TIM1 CH3 pulse, at turn-off
+// the coil rings down with R4 across it and the winding capacitance,
+// D2/D3 clamp the preamp input, which gains 1000 and is divided by 0.33
+// around the receiver baseline. An eddy current target adds a first order
+// decay with its own time constant on top of the coil response.
+typedef struct {
+    double vbat;      // V, BAT
+    double l;         // H, L1
+    double rSeries;   // Ohm, winding and MOSFET on resistance, sets the peak current
+    double rDamp;     // Ohm, R4
+    double c;         // F, winding and cable capacitance, 625 pF damps L1 and R4 critically
+    double clamp;     // V, D2/D3 forward voltage at the preamp input
+    double gain;      // Preamp gain times the output divider
+    double vBase;     // V, ADC pin with no signal
+    double vRef;      // V, ADC full scale
+    double noise;     // V rms at the preamp input
+    double targetAmp; // V, EMF the target induces at turn-off once fully charged
+    double targetTau; // s, eddy current decay time constant of the target
+} Coil_Params_t;
+
+typedef struct {
+    Coil_Params_t p;
+    double tOn;       // Current pulse length, s
+    double target;    // Target EMF at turn-off for this pulse, V
+    double span;      // After turn-off + span both decays are below the noise
+    // Coil ring-down after turn-off:
+    //   overdamped  a (e^(s1 t) - e^(s2 t))
+    //   critical    a t e^(-alpha t)
+    //   underdamped a e^(-alpha t) sin(wd t)
+    double a;
+    double alpha;
+    double s1;
+    double s2;
+    double wd;
+    uint8_t damping;  // 0 over, 1 critical, 2 under
+    uint64_t rng;
+} Coil_t;
+
+void Coil_Defaults(Coil_Params_t *params);
+void Coil_Init(Coil_t *coil, const Coil_Params_t *params, uint64_t seed);
+void Coil_Pulse(Coil_t *coil, double tOn, double targetScale);
+double Coil_Volts(Coil_t *coil, double t);
+double Coil_Gauss(Coil_t *coil);
@@ -0,0 +1,135 @@
+#include "edf.h"
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Header fields are space padded ASCII of a fixed width
+static void Edf_Field(const char *src, size_t width, char *dst) {
+    memcpy(dst, src, width);
+    dst[width] = 0;
+    while (width && isspace((unsigned char) dst[width - 1]))
+        dst[--width] = 0;
+}
+
+static double Edf_Number(const char *src, size_t width) {
+    char buf[81];
+    Edf_Field(src, width, buf);
+    return atof(buf);
+}
+
+// Physical dimension to volts, unknown units are taken as they are
+static double Edf_Unit(const char *dim) {
+    if (strcmp(dim, "uV") == 0)
+        return 1e-6;
+    if (strcmp(dim, "mV") == 0)
+        return 1e-3;
+    if (strcmp(dim, "kV") == 0)
+        return 1e3;
+    return 1.0;
+}
+
+/**
+ * @brief Parse the header and position the reader before the first data record.
+ * * @param edf Pointer to the reader.
+ * @param path File to open.
+ * @return 0 on success, -1 with the reason printed on stderr.
+ */
+int Edf_Open(Edf_t *edf, const char *path) {
+    memset(edf, 0, sizeof(*edf));
+    edf->recordIndex = -1;
+    edf->file = fopen(path, "rb");
+    if (!edf->file) {
+        perror(path);
+        return -1;
+    }
+
+    char fixed[256];
+    if (fread(fixed, 1, sizeof(fixed), edf->file) != sizeof(fixed) || fixed[0] != '0') {
+        fprintf(stderr, "%s: not an EDF file\n", path);
+        Edf_Close(edf);
+        return -1;
+    }
+    edf->dataStart = (long) Edf_Number(&fixed[184], 8);
+    edf->records = (int32_t) Edf_Number(&fixed[236], 8);
+    edf->duration = Edf_Number(&fixed[244], 8);
+    uint32_t count = (uint32_t) Edf_Number(&fixed[252], 4);
+    if (count == 0 || count > EDF_MAX_SIGNALS || edf->duration <= 0.0 ||
+        edf->dataStart != 256 + 256 * (long) count) {
+        fprintf(stderr, "%s: unsupported EDF header (%u signals)\n", path, count);
+        Edf_Close(edf);
+        return -1;
+    }
+    edf->signalCount = (uint16_t) count;
+
+    // The signal header is field by field: all labels, then all transducers, ...
+    char *signal = malloc(256 * count);
+    if (fread(signal, 1, 256 * count, edf->file) != 256 * count) {
+        fprintf(stderr, "%s: truncated header\n", path);
+        free(signal);
+        Edf_Close(edf);
+        return -1;
+    }
+    const char *labels = signal;
+    const char *dims = labels + 96 * count;
+    const char *physMin = dims + 8 * count;
+    const char *physMax = physMin + 8 * count;
+    const char *digMin = physMax + 8 * count;
+    const char *digMax = digMin + 8 * count;
+    const char *samples = digMax + 8 * count + 80 * count;
+
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        Edf_Signal_t *s = &edf->signals[i];
+        char dim[9];
+        Edf_Field(&labels[16 * i], 16, s->label);
+        Edf_Field(&dims[8 * i], 8, dim);
+        double pMin = Edf_Number(&physMin[8 * i], 8);
+        double pMax = Edf_Number(&physMax[8 * i], 8);
+        double dMin = Edf_Number(&digMin[8 * i], 8);
+        double dMax = Edf_Number(&digMax[8 * i], 8);
+        double unit = Edf_Unit(dim);
+        s->scale = dMax != dMin ? (pMax - pMin) / (dMax - dMin) * unit : unit;
+        s->base = (pMin - dMin * (dMax != dMin ? (pMax - pMin) / (dMax - dMin) : 1.0)) * unit;
+        s->samples = (uint32_t) Edf_Number(&samples[8 * i], 8);
+        s->offset = offset;
+        offset += s->samples;
+    }
+    free(signal);
+
+    edf->recordSamples = offset;
+    edf->record = malloc(sizeof(int16_t) * offset);
+    return 0;
+}
+
+void Edf_Close(Edf_t *edf) {
+    if (edf->file)
+        fclose(edf->file);
+    free(edf->record);
+    edf->file = NULL;
+    edf->record = NULL;
+}
+
+/**
+ * @brief Read the next data record into memory.
+ * * @param edf Pointer to the reader.
+ * @return 1 if a record was read, 0 at the end of the file.
+ */
+int Edf_ReadRecord(Edf_t *edf) {
+    if (edf->records >= 0 && edf->recordIndex + 1 >= edf->records)
+        return 0;
+    if (fread(edf->record, sizeof(int16_t), edf->recordSamples, edf->file) != edf->recordSamples)
+        return 0;
+
+    // Samples are little endian two's complement
+    uint8_t *bytes = (uint8_t *) edf->record;
+    for (uint32_t i = 0; i < edf->recordSamples; i++)
+        edf->record[i] = (int16_t) (bytes[2 * i] | bytes[2 * i + 1] << 8);
+    edf->recordIndex++;
+    return 1;
+}
+
+void Edf_Rewind(Edf_t *edf) {
+    fseek(edf->file, edf->dataStart, SEEK_SET);
+    edf->recordIndex = -1;
+}
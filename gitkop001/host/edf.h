@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Streaming reader for EDF/EDF+ files, the format the oscilloscope saves
+// the captures in measurements/*.toml as. One data record is held in
+// memory at a time, so a capture of any length reads in constant space.
+#define EDF_MAX_SIGNALS 16
+
+typedef struct {
+    char label[17];
+    uint32_t samples;   // Per data record
+    uint32_t offset;    // Of the signal in a data record, in samples
+    double scale;       // Physical volts per digital step
+    double base;        // Physical volts at digital 0
+} Edf_Signal_t;
+
+typedef struct {
+    FILE *file;
+    long dataStart;
+    int32_t records;    // -1 when the header left it open
+    double duration;    // Seconds per data record
+    uint16_t signalCount;
+    Edf_Signal_t signals[EDF_MAX_SIGNALS];
+    uint32_t recordSamples;
+    int16_t *record;
+    int32_t recordIndex; // Of the record in memory, -1 before the first read
+} Edf_t;
+
+int Edf_Open(Edf_t *edf, const char *path);
+void Edf_Close(Edf_t *edf);
+int Edf_ReadRecord(Edf_t *edf);
+void Edf_Rewind(Edf_t *edf);
+
+/**
+ * @brief Physical value of a sample in the record in memory.
+ * * @param edf Pointer to the reader.
+ * @param signal Signal index.
+ * @param i Sample index within the record.
+ * @return Volts for uV, mV and V signals, other units as they are.
+ */
+static inline double Edf_Sample(const Edf_t *edf, uint16_t signal, uint32_t i) {
+    const Edf_Signal_t *s = &edf->signals[signal];
+    return s->base + s->scale * edf->record[s->offset + i];
+}
+
+static inline double Edf_SampleRate(const Edf_t *edf, uint16_t signal) {
+    return edf->signals[signal].samples / edf->duration;
+}
@@ -0,0 +1,207 @@
+// edf_gen: a synthetic oscilloscope capture for the --edf replay, so the
+// replay path runs without a capture from the bench. The coil model in
+// coil.c is sampled the way the scope in measurements/pulse_out.toml is
+// wired: channel 0 the PULSE_OUT gate, channel 1 the ADC pin. With
+// --target-amp every pulse sees the target, for --edf-metal.
+#define _GNU_SOURCE
+#include <getopt.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "coil.h"
+
+#define GEN_RECORD_S 0.001
+#define GEN_GATE_V 3.3
+
+typedef struct {
+    const char *label;
+    const char *dim;
+    double physMin;
+    double physMax;
+} Gen_Signal_t;
+
+static const Gen_Signal_t genSignals[] = {
+    { "PULSE_OUT", "V", 0.0, GEN_GATE_V },
+    { "ADC", "V", 0.0, 3.3 },
+};
+#define GEN_SIGNALS (sizeof(genSignals) / sizeof(genSignals[0]))
+
+// Header fields are space padded ASCII of a fixed width, see Edf_Field
+static void Gen_Field(FILE *out, size_t width, const char *fmt, ...) {
+    char buf[96];
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if (len < 0 || (size_t) len > width)
+        len = (int) width;
+    fwrite(buf, 1, (size_t) len, out);
+    for (size_t i = (size_t) len; i < width; i++)
+        fputc(' ', out);
+}
+
+static void Gen_Header(FILE *out, uint32_t records, uint32_t samples) {
+    Gen_Field(out, 8, "0");
+    Gen_Field(out, 80, "X X X gitkop_sim");
+    Gen_Field(out, 80, "Startdate X X X edf_gen");
+    Gen_Field(out, 8, "01.01.24");
+    Gen_Field(out, 8, "00.00.00");
+    Gen_Field(out, 8, "%u", 256 + 256 * (unsigned) GEN_SIGNALS);
+    Gen_Field(out, 44, "");
+    Gen_Field(out, 8, "%u", records);
+    Gen_Field(out, 8, "%g", GEN_RECORD_S);
+    Gen_Field(out, 4, "%u", (unsigned) GEN_SIGNALS);
+
+    // Field by field: all labels, then all transducers, ...
+    for (size_t i = 0; i < GEN_SIGNALS; i++)
+        Gen_Field(out, 16, "%s", genSignals[i].label);
+    for (size_t i = 0; i < GEN_SIGNALS; i++)
+        Gen_Field(out, 80, "coil.c");
+    for (size_t i = 0; i < GEN_SIGNALS; i++)
+        Gen_Field(out, 8, "%s", genSignals[i].dim);
+    for (size_t i = 0; i < GEN_SIGNALS; i++)
+        Gen_Field(out, 8, "%g", genSignals[i].physMin);
+    for (size_t i = 0; i < GEN_SIGNALS; i++)
+        Gen_Field(out, 8, "%g", genSignals[i].physMax);
+    for (size_t i = 0; i < GEN_SIGNALS; i++)
+        Gen_Field(out, 8, "-32768");
+    for (size_t i = 0; i < GEN_SIGNALS; i++)
+        Gen_Field(out, 8, "32767");
+    for (size_t i = 0; i < GEN_SIGNALS; i++)
+        Gen_Field(out, 80, "");
+    for (size_t i = 0; i < GEN_SIGNALS; i++)
+        Gen_Field(out, 8, "%u", samples);
+    for (size_t i = 0; i < GEN_SIGNALS; i++)
+        Gen_Field(out, 32, "");
+}
+
+// Volts to the digital range, little endian two's complement
+static void Gen_Sample(FILE *out, const Gen_Signal_t *s, double v) {
+    double d = (v - s->physMin) / (s->physMax - s->physMin) * 65535.0 - 32768.0;
+    long q = lround(d);
+    if (q < -32768)
+        q = -32768;
+    if (q > 32767)
+        q = 32767;
+    uint16_t u = (uint16_t) (int16_t) q;
+    fputc(u & 0xFF, out);
+    fputc(u >> 8, out);
+}
+
+static void Usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [options] FILE\n"
+            "  --pulses N          pulse periods in the capture (50)\n"
+            "  --rate HZ           scope sample rate (10e6)\n"
+            "  --period-us US      pulse period, TIM1 ARR + 1 (1015)\n"
+            "  --width-us US       transmit pulse, TIM1 CCR3 (15)\n"
+            "  --target-amp MV     target EMF at the coil at turn-off, every pulse (0, no target)\n"
+            "  --target-tau US     target decay time constant (20)\n"
+            "  --noise UV          front end noise, rms at the preamp input (50)\n"
+            "  --seed N            noise seed (1)\n",
+            argv0);
+}
+
+int main(int argc, char **argv) {
+    static const struct option options[] = {
+        { "pulses", required_argument, NULL, 'p' },
+        { "rate", required_argument, NULL, 'r' },
+        { "period-us", required_argument, NULL, 'P' },
+        { "width-us", required_argument, NULL, 'w' },
+        { "target-amp", required_argument, NULL, 'a' },
+        { "target-tau", required_argument, NULL, 't' },
+        { "noise", required_argument, NULL, 'n' },
+        { "seed", required_argument, NULL, 's' },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+
+    Coil_Params_t params;
+    Coil_Defaults(&params);
+    uint32_t pulses = 50;
+    double rate = 10e6;
+    double period = 1015e-6;
+    double width = 15e-6;
+    uint64_t seed = 1;
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+        switch (opt) {
+        case 'p':
+            pulses = (uint32_t) strtoul(optarg, NULL, 0);
+            break;
+        case 'r':
+            rate = atof(optarg);
+            break;
+        case 'P':
+            period = atof(optarg) * 1e-6;
+            break;
+        case 'w':
+            width = atof(optarg) * 1e-6;
+            break;
+        case 'a':
+            params.targetAmp = atof(optarg) * 1e-3;
+            break;
+        case 't':
+            params.targetTau = atof(optarg) * 1e-6;
+            break;
+        case 'n':
+            params.noise = atof(optarg) * 1e-6;
+            break;
+        case 's':
+            seed = strtoull(optarg, NULL, 0);
+            break;
+        default:
+            Usage(argv[0]);
+            return opt != 'h';
+        }
+    }
+    if (optind + 1 != argc || !pulses || rate <= 0.0 || width <= 0.0 || period <= width) {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    FILE *out = fopen(argv[optind], "wb");
+    if (!out) {
+        perror(argv[optind]);
+        return 1;
+    }
+
+    // Whole data records, the capture may end a little after the last pulse
+    uint32_t samples = (uint32_t) lround(rate * GEN_RECORD_S);
+    uint32_t records = (uint32_t) ceil(pulses * period / GEN_RECORD_S);
+    Gen_Header(out, records, samples);
+
+    Coil_t coil;
+    Coil_Init(&coil, &params, seed);
+    Coil_Pulse(&coil, width, 1.0);
+    uint32_t pulse = 0;
+    double *adc = malloc(sizeof(double) * samples);
+    for (uint32_t r = 0; r < records; r++) {
+        // A record holds every sample of the gate, then every sample of the ADC pin
+        for (uint32_t i = 0; i < samples; i++) {
+            double t = (r * (double) samples + i) / rate;
+            uint32_t n = (uint32_t) (t / period);
+            if (n != pulse) {
+                pulse = n;
+                Coil_Pulse(&coil, width, 1.0);
+            }
+            double inPeriod = t - n * period;
+            Gen_Sample(out, &genSignals[0], inPeriod < width ? GEN_GATE_V : 0.0);
+            adc[i] = Coil_Volts(&coil, inPeriod);
+        }
+        for (uint32_t i = 0; i < samples; i++)
+            Gen_Sample(out, &genSignals[1], adc[i]);
+    }
+    free(adc);
+
+    if (fclose(out) != 0) {
+        perror(argv[optind]);
+        return 1;
+    }
+    fprintf(stderr, "%s: %u pulses, %u records of %u samples per signal\n", argv[optind], pulses, records, samples);
+    return 0;
+}
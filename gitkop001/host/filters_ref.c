@@ -0,0 +1,203 @@
+// Fixed-point filters from filters.h against a double precision model fed the
+// same quantized coefficients. Every update rounds once, so the fixed-point
+// output may only differ from the model by that rounding carried through the
+// filter's own feedback; the bound is worked out per filter. The outputs are
+// also hashed: the input is integer only, so every compiler and target has to
+// produce the same bits, and a changed hash means the arithmetic changed.
+// Exits non-zero on a failure. Without the host build:
+//   cc -O2 -I../Core/Src filters_ref.c -lm -o filters_ref && ./filters_ref
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "filters.h"
+
+#define REF_SAMPLES 200000
+#define REF_SEGMENT 25000
+#define REF_LSB (1.0 / (1 << FILT_Q))
+// Largest input the header allows, Q15.16
+#define REF_LIMIT FILT_FROM_INT(16383)
+
+typedef struct {
+    const char *name;
+    double maxError; // LSB of Q15.16
+    double bound;
+    uint64_t hash;
+    uint64_t expected;
+} Ref_Result_t;
+
+static uint32_t refSeed = 1;
+
+// Uniform in [-amplitude, amplitude], Q15.16
+static int32_t Ref_Noise(int32_t amplitude) {
+    refSeed = refSeed * 1664525u + 1013904223u;
+    return (int32_t) (((int64_t) (refSeed >> 8) * (2 * (int64_t) amplitude + 1)) >> 24) - amplitude;
+}
+
+// Input n: the crossing time the firmware filters, full scale steps, a
+// triangle over the whole range and full range noise, in turn
+static int32_t Ref_Input(uint32_t n) {
+    uint32_t k = n % REF_SEGMENT;
+    switch ((n / REF_SEGMENT) % 4) {
+    case 0:
+        return FILT_FROM_INT(22) + Ref_Noise(FILT_FROM_FLOAT(0.1f));
+    case 1:
+        return (k / 500) & 1 ? -REF_LIMIT : REF_LIMIT;
+    case 2: {
+        int32_t phase = (int32_t) (k % 4000);
+        int32_t tri = phase < 2000 ? phase - 1000 : 3000 - phase;
+        return (int32_t) ((int64_t) tri * REF_LIMIT / 1000);
+    }
+    default:
+        return Ref_Noise(REF_LIMIT);
+    }
+}
+
+// Restarts the input, every filter sees the same one. Returns the value the
+// filters start from, the mean of the first segment.
+static int32_t Ref_Start(void) {
+    refSeed = 1;
+    return FILT_FROM_INT(22);
+}
+
+static void Ref_Hash(uint64_t *hash, int32_t v) {
+    for (uint8_t i = 0; i < 4; i++) {
+        *hash ^= (uint8_t) ((uint32_t) v >> (8 * i));
+        *hash *= 0x100000001B3ull;
+    }
+}
+
+static void Ref_Compare(Ref_Result_t *r, int32_t fixed, double model) {
+    double error = fabs((double) fixed - model / REF_LSB);
+    if (error > r->maxError)
+        r->maxError = error;
+    Ref_Hash(&r->hash, fixed);
+}
+
+static void Ref_Ema(Ref_Result_t *r, float alpha) {
+    EMA_t filt;
+    int32_t a = Filt_Q31(alpha);
+    double ad = a / 2147483648.0;
+    int32_t x0 = Ref_Start();
+    EMA_Init(&filt, a, x0);
+    double y = x0 * REF_LSB;
+    for (uint32_t n = 0; n < REF_SAMPLES; n++) {
+        int32_t x = Ref_Input(n);
+        y += ad * (x * REF_LSB - y);
+        Ref_Compare(r, EMA_Update(&filt, x), y);
+    }
+    // e[n] = (1 - a) e[n-1] + rounding
+    r->bound = 0.5 / ad;
+}
+
+// Lowpass section from the audio EQ cookbook, cutoff as a fraction of the rate
+static void Ref_Biquad(Ref_Result_t *r, double cutoff, double q) {
+    double w = 2.0 * M_PI * cutoff;
+    double alpha = sin(w) / (2.0 * q);
+    double a0 = 1.0 + alpha;
+    int32_t b0 = Filt_Q30((float) ((1.0 - cos(w)) / 2.0 / a0));
+    int32_t b1 = Filt_Q30((float) ((1.0 - cos(w)) / a0));
+    int32_t a1 = Filt_Q30((float) (-2.0 * cos(w) / a0));
+    int32_t a2 = Filt_Q30((float) ((1.0 - alpha) / a0));
+    double bd[3] = { b0 / (double) FILT_Q30_ONE, b1 / (double) FILT_Q30_ONE, b0 / (double) FILT_Q30_ONE };
+    double ad[2] = { a1 / (double) FILT_Q30_ONE, a2 / (double) FILT_Q30_ONE };
+
+    Biquad_t filt;
+    int32_t x0 = Ref_Start();
+    Biquad_Init(&filt, b0, b1, b0, a1, a2, x0);
+    double x1 = x0 * REF_LSB, x2 = x1, y1 = x1, y2 = x1;
+    for (uint32_t n = 0; n < REF_SAMPLES; n++) {
+        int32_t x = Ref_Input(n);
+        double xd = x * REF_LSB;
+        double y = bd[0] * xd + bd[1] * x1 + bd[2] * x2 - ad[0] * y1 - ad[1] * y2;
+        x2 = x1;
+        x1 = xd;
+        y2 = y1;
+        y1 = y;
+        Ref_Compare(r, Biquad_Update(&filt, x), y);
+    }
+
+    // The rounding goes through the feedback 1 / (1 + a1 z^-1 + a2 z^-2),
+    // its error is at most half an LSB times the sum of |h|
+    double h1 = 0.0, h2 = 0.0, sum = 0.0;
+    for (uint32_t n = 0; n < REF_SAMPLES; n++) {
+        double h = (n == 0) - ad[0] * h1 - ad[1] * h2;
+        h2 = h1;
+        h1 = h;
+        sum += fabs(h);
+    }
+    r->bound = 0.5 * sum;
+}
+
+static void Ref_MovingAvg(Ref_Result_t *r, uint8_t log2Len) {
+    MovingAvg_t filt;
+    int32_t x0 = Ref_Start();
+    MovingAvg_Init(&filt, log2Len, x0);
+    double window[1 << MOVING_AVG_MAX_LOG2];
+    for (uint32_t i = 0; i < (1u << log2Len); i++)
+        window[i] = x0 * REF_LSB;
+    for (uint32_t n = 0; n < REF_SAMPLES; n++) {
+        int32_t x = Ref_Input(n);
+        window[n & ((1u << log2Len) - 1)] = x * REF_LSB;
+        double sum = 0.0;
+        for (uint32_t i = 0; i < (1u << log2Len); i++)
+            sum += window[i];
+        Ref_Compare(r, MovingAvg_Update(&filt, x), sum / (1 << log2Len));
+    }
+    // The running sum is exact, only the final shift rounds
+    r->bound = 0.5;
+}
+
+// Steps into the DC blocker have to stay below 16383, it gets half the input
+static void Ref_DcBlock(Ref_Result_t *r, float pole) {
+    DcBlock_t filt;
+    int32_t p = Filt_Q31(pole);
+    double pd = p / 2147483648.0;
+    int32_t x0 = Ref_Start() / 2;
+    DcBlock_Init(&filt, p, x0);
+    double x1 = x0 * REF_LSB, y = 0.0;
+    for (uint32_t n = 0; n < REF_SAMPLES; n++) {
+        int32_t x = Ref_Input(n) / 2;
+        y = x * REF_LSB - x1 + pd * y;
+        x1 = x * REF_LSB;
+        Ref_Compare(r, DcBlock_Update(&filt, x), y);
+    }
+    // e[n] = pole e[n-1] + rounding
+    r->bound = 0.5 / (1.0 - pd);
+}
+
+int main(void) {
+    // Hashes of the fixed-point outputs, update them only with a change to
+    // the arithmetic in filters.h
+    Ref_Result_t results[] = {
+        { .name = "ema slow", .expected = 0x3EA0CF899F3B3FCEull },
+        { .name = "ema fast", .expected = 0x746D7FA5BD188AD1ull },
+        { .name = "biquad", .expected = 0x638AA57AE0E3AC9Eull },
+        { .name = "moving avg 16", .expected = 0x3D535FCE86043DF8ull },
+        { .name = "moving avg 64", .expected = 0x862511B886A838A8ull },
+        { .name = "dc block", .expected = 0x267EB8156C19F276ull },
+    };
+    const uint8_t count = sizeof(results) / sizeof(results[0]);
+    for (uint8_t i = 0; i < count; i++)
+        results[i].hash = 0xCBF29CE484222325ull;
+
+    // The firmware's slow and fast trackers
+    Ref_Ema(&results[0], 0.0005f);
+    Ref_Ema(&results[1], 0.1f);
+    Ref_Biquad(&results[2], 0.05, M_SQRT1_2);
+    Ref_MovingAvg(&results[3], 4);
+    Ref_MovingAvg(&results[4], MOVING_AVG_MAX_LOG2);
+    Ref_DcBlock(&results[5], 0.995f);
+
+    int failed = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        Ref_Result_t *r = &results[i];
+        // The model itself is good to well below 1e-3 LSB at these magnitudes
+        int bounded = r->maxError <= r->bound + 1e-3;
+        int exact = r->hash == r->expected;
+        printf("%-14s max error %9.3f LSB, bound %9.3f, hash %016llx %s\n", r->name, r->maxError, r->bound,
+               (unsigned long long) r->hash, bounded && exact ? "ok" : !bounded ? "OVER BOUND" : "HASH CHANGED");
+        failed |= !bounded || !exact;
+    }
+    return failed;
+}
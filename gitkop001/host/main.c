@@ -0,0 +1,284 @@
+// gitkop_sim: GitKop.c on the host, against the peripheral model in sim.c
+// and the coil model in coil.c or a replayed capture. The firmware runs from GitKop_Init as on
+// the board; the USART1 byte stream goes to --uart, the plotter reads it
+// back, and a summary of the run is printed on stdout at the end.
+#define _GNU_SOURCE
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "GitKop.h"
+#include "bench.h"
+#include "sim.h"
+#include "uart.h"
+
+static FILE *report;
+static FILE *uart;
+static Replay_t replay;
+static Replay_t replayMetal;
+static Sim_Config_t config;
+static FILE *bench;
+static struct timespec wallStart;
+
+// printf in the firmware must end up in _write and the TX ring, as with newlib
+static ssize_t Stdout_Write(void *cookie, const char *buf, size_t size) {
+    (void) cookie;
+    return _write(1, (char *) buf, (int) size);
+}
+
+static void Done(void) {
+    const Sim_Stats_t *stats = Sim_Stats();
+    struct timespec wallEnd;
+    clock_gettime(CLOCK_MONOTONIC, &wallEnd);
+    double wall = (wallEnd.tv_sec - wallStart.tv_sec) + (wallEnd.tv_nsec - wallStart.tv_nsec) * 1e-9;
+
+    fprintf(report, "pulses %llu in %.3f s simulated, %.3f s wall, %.1fx real time, %.0f pulses/s\n",
+            (unsigned long long) stats->pulses, stats->seconds, wall,
+            wall > 0 ? stats->seconds / wall : 0.0, wall > 0 ? stats->pulses / wall : 0.0);
+    fprintf(report, "samples %llu, interrupts %llu, uart bytes %llu\n",
+            (unsigned long long) stats->samples, (unsigned long long) stats->interrupts,
+            (unsigned long long) stats->uartBytes);
+    if (stats->targetPulses)
+        fprintf(report, "target pulses %llu, alarm on %llu (%.1f%%)\n",
+                (unsigned long long) stats->targetPulses, (unsigned long long) stats->hits,
+                100.0 * stats->hits / stats->targetPulses);
+    if (stats->clearPulses)
+        fprintf(report, "clear pulses %llu, false alarm on %llu (%.2f%%)\n",
+                (unsigned long long) stats->clearPulses, (unsigned long long) stats->falseAlarms,
+                100.0 * stats->falseAlarms / stats->clearPulses);
+    if (stats->passes)
+        fprintf(report, "passes %u, detected %u\n", stats->passes, stats->passesDetected);
+    if (replay.pulses)
+        fprintf(report, "replay %u records, capture played %u times, %.0f S/s\n",
+                replay.pulses, replay.loops + 1, 1.0 / replay.dt);
+    if (bench) {
+        Bench_Write(bench, &config, stats, wall);
+        if (bench != report)
+            fclose(bench);
+    }
+
+    if (uart)
+        fclose(uart);
+    fclose(report);
+    exit(0);
+}
+
+static void Usage(const char *name) {
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --pulses N          TIM1 periods to simulate (20000)\n"
+            "  --settle N          pulses left out of the statistics (2000)\n"
+            "  --seed N            noise seed (1)\n"
+            "  --uart FILE         write the USART1 stream to FILE\n"
+            "  --set NAME=VALUE    send \"set NAME VALUE\" on the command channel, repeatable\n"
+            "  --target-amp MV     target EMF at the coil at turn-off (0, no target)\n"
+            "  --target-tau US     target decay time constant (20)\n"
+            "  --sweep-ms MS       one target pass every MS, 0 keeps it over the coil (2000)\n"
+            "  --sweep-width-ms MS length of a pass (300)\n"
+            "  --noise UV          front end noise, rms at the preamp input (50)\n"
+            "  --adc-noise LSB     converter noise, rms (0.5)\n"
+            "  --edf FILE          replay an oscilloscope capture instead of the coil model\n"
+            "  --measurement TOML  replay a capture from measurements/*.toml, with its channels\n"
+            "  --file-index N      [[files]] entry of --measurement (0)\n"
+            "  --trigger-ch N      EDF trigger channel (0)\n"
+            "  --data-ch N         EDF data channel (1)\n"
+            "  --trigger-level V   trigger level, default the middle of the trigger swing\n"
+            "  --replay-gain G     ADC pin volts = offset + G * data volts (1)\n"
+            "  --replay-offset V   (0)\n"
+            "  --replay-target 0|1 the capture has metal near the coil (0)\n"
+            "  --edf-metal FILE    capture with metal, played during the passes with --edf as the clear one\n"
+            "  --bench FILE        score the detectors on the pulse frames, JSON to FILE, - for stdout\n",
+            name);
+}
+
+int main(int argc, char **argv) {
+    static const struct option options[] = {
+        { "pulses", required_argument, NULL, 'p' },
+        { "settle", required_argument, NULL, 'S' },
+        { "seed", required_argument, NULL, 's' },
+        { "uart", required_argument, NULL, 'u' },
+        { "set", required_argument, NULL, 'c' },
+        { "target-amp", required_argument, NULL, 'a' },
+        { "target-tau", required_argument, NULL, 't' },
+        { "sweep-ms", required_argument, NULL, 'w' },
+        { "sweep-width-ms", required_argument, NULL, 'W' },
+        { "noise", required_argument, NULL, 'n' },
+        { "adc-noise", required_argument, NULL, 'N' },
+        { "edf", required_argument, NULL, 'e' },
+        { "measurement", required_argument, NULL, 'm' },
+        { "file-index", required_argument, NULL, 'i' },
+        { "trigger-ch", required_argument, NULL, 'T' },
+        { "data-ch", required_argument, NULL, 'D' },
+        { "trigger-level", required_argument, NULL, 'L' },
+        { "replay-gain", required_argument, NULL, 'g' },
+        { "replay-offset", required_argument, NULL, 'o' },
+        { "replay-target", required_argument, NULL, 'r' },
+        { "edf-metal", required_argument, NULL, 'E' },
+        { "bench", required_argument, NULL, 'B' },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+
+    Coil_Defaults(&config.coil);
+    config.seed = 1;
+    config.pulses = 20000;
+    config.settle = 2000;
+    config.sweepPeriod = 2.0;
+    config.sweepWidth = 0.3;
+    config.adcNoise = 0.5;
+    config.commands = calloc(argc + 1, sizeof(char *));
+
+    const char *edfPath = NULL;
+    const char *metalPath = NULL;
+    const char *benchPath = NULL;
+    const char *measurement = NULL;
+    uint16_t fileIndex = 0;
+    uint16_t triggerCh = 0;
+    uint16_t dataCh = 1;
+    double triggerLevel = NAN;
+    double replayGain = 1.0;
+    double replayOffset = 0.0;
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+        switch (opt) {
+        case 'p':
+            config.pulses = strtoull(optarg, NULL, 0);
+            break;
+        case 'S':
+            config.settle = strtoull(optarg, NULL, 0);
+            break;
+        case 's':
+            config.seed = strtoull(optarg, NULL, 0);
+            break;
+        case 'u':
+            uart = fopen(optarg, "wb");
+            if (!uart) {
+                perror(optarg);
+                return 1;
+            }
+            break;
+        case 'c': {
+            char *eq = strchr(optarg, '=');
+            if (!eq) {
+                Usage(argv[0]);
+                return 1;
+            }
+            *eq = ' ';
+            char *line = malloc(strlen(optarg) + 5);
+            sprintf(line, "set %s", optarg);
+            config.commands[config.commandCount++] = line;
+            break;
+        }
+        case 'a':
+            config.coil.targetAmp = atof(optarg) * 1e-3;
+            break;
+        case 't':
+            config.coil.targetTau = atof(optarg) * 1e-6;
+            break;
+        case 'w':
+            config.sweepPeriod = atof(optarg) * 1e-3;
+            break;
+        case 'W':
+            config.sweepWidth = atof(optarg) * 1e-3;
+            break;
+        case 'n':
+            config.coil.noise = atof(optarg) * 1e-6;
+            break;
+        case 'N':
+            config.adcNoise = atof(optarg);
+            break;
+        case 'e':
+            edfPath = optarg;
+            break;
+        case 'm':
+            measurement = optarg;
+            break;
+        case 'i':
+            fileIndex = (uint16_t) atoi(optarg);
+            break;
+        case 'T':
+            triggerCh = (uint16_t) atoi(optarg);
+            break;
+        case 'D':
+            dataCh = (uint16_t) atoi(optarg);
+            break;
+        case 'L':
+            triggerLevel = atof(optarg);
+            break;
+        case 'g':
+            replayGain = atof(optarg);
+            break;
+        case 'o':
+            replayOffset = atof(optarg);
+            break;
+        case 'r':
+            config.replayTarget = atoi(optarg) != 0;
+            break;
+        case 'E':
+            metalPath = optarg;
+            break;
+        case 'B':
+            benchPath = optarg;
+            break;
+        default:
+            Usage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    char measured[1024];
+    if (measurement) {
+        if (Replay_Measurement(measurement, fileIndex, measured, sizeof(measured), &triggerCh, &dataCh) != 0)
+            return 1;
+        edfPath = measured;
+    }
+    if (edfPath) {
+        if (Replay_Open(&replay, edfPath, triggerCh, dataCh, triggerLevel) != 0)
+            return 1;
+        replay.gain = replayGain;
+        replay.offset = replayOffset;
+        config.replay = &replay;
+    }
+    if (metalPath) {
+        if (!config.replay) {
+            fprintf(stderr, "--edf-metal needs --edf or --measurement for the clear capture\n");
+            return 1;
+        }
+        if (Replay_Open(&replayMetal, metalPath, triggerCh, dataCh, triggerLevel) != 0)
+            return 1;
+        replayMetal.gain = replayGain;
+        replayMetal.offset = replayOffset;
+        config.replayMetal = &replayMetal;
+    }
+
+    // The summary keeps the real stdout, the firmware's printf goes to the UART
+    report = fdopen(dup(STDOUT_FILENO), "w");
+    cookie_io_functions_t io = { .write = Stdout_Write };
+    stdout = fopencookie(NULL, "w", io);
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    // The benchmark reads the pulse frames, which the firmware only sends with debug on
+    if (benchPath) {
+        bench = strcmp(benchPath, "-") ? fopen(benchPath, "w") : report;
+        if (!bench) {
+            perror(benchPath);
+            return 1;
+        }
+        config.commands[config.commandCount++] = "set debug 1";
+        config.pulseHook = Bench_Pulse;
+        config.uartHook = Bench_Uart;
+        Bench_Init(config.settle);
+    }
+
+    config.uart = uart;
+    config.done = Done;
+    Sim_Init(&config);
+    clock_gettime(CLOCK_MONOTONIC, &wallStart);
+    GitKop_Init();
+    return 0;
+}
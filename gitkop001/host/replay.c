@@ -0,0 +1,236 @@
+#include "replay.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int Replay_Sample(Replay_t *replay, double *trigger, double *data) {
+    if (replay->edf.recordIndex < 0 || replay->index >= replay->edf.signals[replay->trigger].samples) {
+        if (!Edf_ReadRecord(&replay->edf))
+            return 0;
+        replay->index = 0;
+    }
+    *trigger = Edf_Sample(&replay->edf, replay->trigger, replay->index);
+    *data = Edf_Sample(&replay->edf, replay->data, replay->index);
+    replay->index++;
+    replay->sample++;
+    return 1;
+}
+
+// Rising edge through the level, timed between the two samples around it
+static int Replay_Edge(Replay_t *replay, double trigger, double *at) {
+    int edge = 0;
+    if (trigger < replay->level - replay->hysteresis)
+        replay->armed = 1;
+    else if (replay->armed && trigger >= replay->level && replay->sample > 1) {
+        double frac = (replay->level - replay->lastTrigger) / (trigger - replay->lastTrigger);
+        *at = (replay->sample - 2 + frac) * replay->dt;
+        replay->armed = 0;
+        edge = 1;
+    }
+    replay->lastTrigger = trigger;
+    return edge;
+}
+
+static void Replay_Restart(Replay_t *replay) {
+    Edf_Rewind(&replay->edf);
+    replay->index = 0;
+    replay->sample = 0;
+    replay->armed = 0;
+    replay->loops++;
+}
+
+/**
+ * @brief Open a capture and find the trigger level.
+ * * @param replay Pointer to the replay.
+ * @param path EDF file.
+ * @param trigger Trigger channel index.
+ * @param data Data channel index.
+ * @param level Trigger level in volts, NAN for the middle of the trigger channel swing.
+ * @return 0 on success, -1 with the reason printed on stderr.
+ */
+int Replay_Open(Replay_t *replay, const char *path, uint16_t trigger, uint16_t data, double level) {
+    memset(replay, 0, sizeof(*replay));
+    if (Edf_Open(&replay->edf, path) != 0)
+        return -1;
+
+    Edf_t *edf = &replay->edf;
+    if (trigger >= edf->signalCount || data >= edf->signalCount) {
+        fprintf(stderr, "%s: %u signals, no channel %u\n", path, edf->signalCount,
+                trigger > data ? trigger : data);
+        Edf_Close(edf);
+        return -1;
+    }
+    if (edf->signals[trigger].samples != edf->signals[data].samples || !edf->signals[data].samples) {
+        fprintf(stderr, "%s: trigger and data channels have different sample rates\n", path);
+        Edf_Close(edf);
+        return -1;
+    }
+
+    replay->trigger = trigger;
+    replay->data = data;
+    replay->dt = 1.0 / Edf_SampleRate(edf, data);
+    replay->gain = 1.0;
+    replay->edge = -1.0;
+
+    // One pass over the capture for the trigger swing
+    double low = INFINITY;
+    double high = -INFINITY;
+    double t, d;
+    while (Replay_Sample(replay, &t, &d)) {
+        if (t < low)
+            low = t;
+        if (t > high)
+            high = t;
+    }
+    if (!(high > low)) {
+        fprintf(stderr, "%s: the trigger channel is flat\n", path);
+        Edf_Close(edf);
+        return -1;
+    }
+    replay->level = isnan(level) ? (low + high) / 2 : level;
+    replay->hysteresis = (high - low) * 0.1;
+    Replay_Restart(replay);
+    replay->loops = 0;
+    return 0;
+}
+
+void Replay_Close(Replay_t *replay) {
+    Edf_Close(&replay->edf);
+}
+
+/**
+ * @brief Cut the next pulse record out of the capture.
+ * The record runs from a trigger edge to the next one, the end of the
+ * capture or REPLAY_MAX_BINS, whichever comes first.
+ * * @param replay Pointer to the replay.
+ * @return 0 on success, -1 if the capture has no trigger edge at all.
+ */
+int Replay_Next(Replay_t *replay) {
+    double trigger, data;
+    uint8_t restarted = 0;
+    while (replay->edge < 0) {
+        if (!Replay_Sample(replay, &trigger, &data)) {
+            if (restarted) {
+                fprintf(stderr, "replay: no trigger edge in the capture\n");
+                return -1;
+            }
+            Replay_Restart(replay);
+            restarted = 1;
+            continue;
+        }
+        if (Replay_Edge(replay, trigger, &replay->edge))
+            replay->edgeData = data;
+    }
+
+    // The sample the edge was found on is the first one of the record
+    double start = replay->edge;
+    uint64_t sample = replay->sample - 1;
+    memset(replay->bins, 0, sizeof(replay->bins));
+    memset(replay->counts, 0, sizeof(replay->counts));
+    replay->binCount = 0;
+    replay->edge = -1.0;
+    data = replay->edgeData;
+
+    while (1) {
+        uint32_t k = (uint32_t) ((sample * replay->dt - start) / REPLAY_BIN_S + 0.5);
+        if (k >= REPLAY_MAX_BINS)
+            break;
+        replay->bins[k] += (float) data;
+        replay->counts[k]++;
+        if (k + 1 > replay->binCount)
+            replay->binCount = (uint16_t) (k + 1);
+
+        if (!Replay_Sample(replay, &trigger, &data))
+            break;
+        sample = replay->sample - 1;
+        if (Replay_Edge(replay, trigger, &replay->edge)) {
+            replay->edgeData = data;
+            break;
+        }
+    }
+
+    // Bin averages, a capture slower than the grid leaves gaps to interpolate over
+    int32_t prev = -1;
+    for (uint32_t k = 0; k < replay->binCount; k++) {
+        if (!replay->counts[k])
+            continue;
+        replay->bins[k] /= replay->counts[k];
+        if (prev >= 0 && k - prev > 1) {
+            for (uint32_t j = prev + 1; j < k; j++)
+                replay->bins[j] = replay->bins[prev] + (replay->bins[k] - replay->bins[prev]) * (float) (j - prev) / (float) (k - prev);
+        }
+        prev = (int32_t) k;
+    }
+    for (uint32_t k = 0; k < replay->binCount; k++)
+        replay->bins[k] = (float) (replay->offset + replay->gain * replay->bins[k]);
+
+    replay->pulses++;
+    return 0;
+}
+
+// Minimal reader for the keys of measurements/*.toml the replay needs
+static void Replay_Trim(char *s) {
+    size_t len = strlen(s);
+    while (len && (s[len - 1] == '\n' || s[len - 1] == '\r' || s[len - 1] == ' ' || s[len - 1] == '\t'))
+        s[--len] = 0;
+}
+
+/**
+ * @brief Look up a capture in a measurement description.
+ * * @param toml One of the measurements/ toml files.
+ * @param fileIndex Which [[files]] entry to take.
+ * @param path Receives the EDF path, relative paths resolved against the toml directory.
+ * @param pathSize Size of path.
+ * @param trigger Receives trigger_ch_index.
+ * @param data Receives data_ch_index.
+ * @return 0 on success, -1 with the reason printed on stderr.
+ */
+int Replay_Measurement(const char *toml, uint16_t fileIndex, char *path, size_t pathSize, uint16_t *trigger, uint16_t *data) {
+    FILE *file = fopen(toml, "r");
+    if (!file) {
+        perror(toml);
+        return -1;
+    }
+
+    char line[512];
+    char found[512] = "";
+    int32_t files = -1;
+    while (fgets(line, sizeof(line), file)) {
+        Replay_Trim(line);
+        char *p = line;
+        while (*p == ' ' || *p == '\t')
+            p++;
+        if (strncmp(p, "[[files]]", 9) == 0) {
+            files++;
+            continue;
+        }
+
+        unsigned value;
+        if (sscanf(p, "trigger_ch_index = %u", &value) == 1)
+            *trigger = (uint16_t) value;
+        else if (sscanf(p, "data_ch_index = %u", &value) == 1)
+            *data = (uint16_t) value;
+        else if (files == fileIndex && strncmp(p, "path", 4) == 0) {
+            char *open = strchr(p, '"');
+            char *close = open ? strchr(open + 1, '"') : NULL;
+            if (open && close) {
+                *close = 0;
+                snprintf(found, sizeof(found), "%s", open + 1);
+            }
+        }
+    }
+    fclose(file);
+
+    if (!found[0]) {
+        fprintf(stderr, "%s: no [[files]] entry %u\n", toml, fileIndex);
+        return -1;
+    }
+    const char *slash = strrchr(toml, '/');
+    if (found[0] == '/' || !slash)
+        snprintf(path, pathSize, "%s", found);
+    else
+        snprintf(path, pathSize, "%.*s/%s", (int) (slash - toml), toml, found);
+    return 0;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "edf.h"
+
+// Oscilloscope capture in place of the coil model: the trigger channel
+// (the PULSE_OUT gate in measurements/pulse_out.toml) cuts the data channel
+// into pulse records, each starting at a rising edge like a TIM1 period.
+// A record is averaged into bins on the ADC conversion grid, the simulator
+// reads it back by linear interpolation for whatever profile is active.
+// At the end of the file the capture starts over.
+#define REPLAY_MAX_BINS 8192
+#define REPLAY_BIN_S 240e-9 // 2.5 + 12.5 ADC cycles at 62.5 MHz, 4.17 MS/s
+
+typedef struct {
+    Edf_t edf;
+    uint16_t trigger;
+    uint16_t data;
+    double level;       // Trigger level with hysteresis either side, V
+    double hysteresis;
+    double gain;        // ADC pin volts = offset + gain * data channel volts
+    double offset;
+    double dt;          // Capture sample period
+
+    // Position in the capture
+    uint32_t index;     // Sample in the record in memory
+    uint64_t sample;    // Since the start of the file
+    double lastTrigger;
+    uint8_t armed;      // Trigger went below level - hysteresis since the last edge
+    double edge;        // Sample time of the edge that starts the next record, -1 if not found yet
+    double edgeData;    // Data channel on the sample the edge was found on
+
+    float bins[REPLAY_MAX_BINS];
+    uint16_t counts[REPLAY_MAX_BINS];
+    uint16_t binCount;
+
+    uint32_t pulses;    // Records cut since the start
+    uint32_t loops;     // Times the capture was started over
+} Replay_t;
+
+int Replay_Open(Replay_t *replay, const char *path, uint16_t trigger, uint16_t data, double level);
+int Replay_Measurement(const char *toml, uint16_t fileIndex, char *path, size_t pathSize, uint16_t *trigger, uint16_t *data);
+int Replay_Next(Replay_t *replay);
+void Replay_Close(Replay_t *replay);
+
+/**
+ * @brief Voltage at the ADC pin.
+ * * @param replay Pointer to the replay.
+ * @param t Time since the trigger edge of the current record, s.
+ * @return Volts, the last bin is held past the end of the record.
+ */
+static inline double Replay_Volts(const Replay_t *replay, double t) {
+    double x = t / REPLAY_BIN_S;
+    if (x <= 0.0)
+        return replay->bins[0];
+    uint32_t k = (uint32_t) x;
+    if (k + 1 >= replay->binCount)
+        return replay->bins[replay->binCount - 1];
+    double frac = x - k;
+    return replay->bins[k] + (replay->bins[k + 1] - replay->bins[k]) * frac;
+}
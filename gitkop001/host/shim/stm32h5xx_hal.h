@@ -0,0 +1,430 @@
+#pragma once
+
+// Host stand-in for the CMSIS device header and the STM32H5 HAL, just the
+// part GitKop.c, command.c and the soft I2C ssd1306.c use. Peripherals are
+// plain structs in host memory: the firmware reads and writes them as it
+// would the registers, sim.c reads them back and calls the HAL callbacks.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- CMSIS core ----
+
+#define __IO volatile
+
+#define __NOP() do { } while (0)
+#define __DSB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DMB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+// Interrupts only ever run inside __WFI and HAL_Delay, masking is a no-op
+#define __disable_irq() do { } while (0)
+#define __enable_irq() do { } while (0)
+#define __WFI() Sim_Wfi()
+
+void Sim_Wfi(void);
+
+typedef struct {
+    __IO uint32_t CTRL;
+    __IO uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+
+extern DWT_Type simDwt;
+extern CoreDebug_Type simCoreDebug;
+#define DWT (&simDwt)
+#define CoreDebug (&simCoreDebug)
+
+extern uint32_t SystemCoreClock;
+
+// ---- HAL common ----
+
+typedef enum {
+    HAL_OK = 0x00,
+    HAL_ERROR = 0x01,
+    HAL_BUSY = 0x02,
+    HAL_TIMEOUT = 0x03
+} HAL_StatusTypeDef;
+
+typedef enum {
+    DISABLE = 0,
+    ENABLE = !DISABLE
+} FunctionalState;
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t delay);
+uint32_t HAL_RCC_GetHCLKFreq(void);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+
+// ---- GPIO ----
+
+typedef struct {
+    __IO uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef enum {
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+extern GPIO_TypeDef simGpioA, simGpioB, simGpioC;
+#define GPIOA (&simGpioA)
+#define GPIOB (&simGpioB)
+#define GPIOC (&simGpioC)
+
+#define GPIO_PIN_0 ((uint16_t) 0x0001)
+#define GPIO_PIN_1 ((uint16_t) 0x0002)
+#define GPIO_PIN_6 ((uint16_t) 0x0040)
+#define GPIO_PIN_8 ((uint16_t) 0x0100)
+#define GPIO_PIN_9 ((uint16_t) 0x0200)
+#define GPIO_PIN_10 ((uint16_t) 0x0400)
+#define GPIO_PIN_13 ((uint16_t) 0x2000)
+#define GPIO_PIN_15 ((uint16_t) 0x8000)
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+
+// ---- CRC: no unit on the host, telemetry.h computes the CRC32 in software ----
+
+#define __HAL_RCC_CRC_CLK_ENABLE() do { } while (0)
+
+// ---- TIM ----
+
+typedef struct {
+    __IO uint32_t CR1;
+    __IO uint32_t DIER;
+    __IO uint32_t CNT;
+    __IO uint32_t PSC;
+    __IO uint32_t ARR;
+    __IO uint32_t CCR1;
+    __IO uint32_t CCR2;
+    __IO uint32_t CCR3;
+    __IO uint32_t CCR4;
+} TIM_TypeDef;
+
+#define TIM_CR1_ARPE (1UL << 7)
+#define TIM_IT_CC3 (1UL << 3)
+
+typedef struct {
+    uint32_t Prescaler;
+    uint32_t Period;
+    uint32_t RepetitionCounter;
+} TIM_Base_InitTypeDef;
+
+typedef enum {
+    HAL_TIM_ACTIVE_CHANNEL_3 = 0x04,
+    HAL_TIM_ACTIVE_CHANNEL_CLEARED = 0x00,
+} HAL_TIM_ActiveChannel;
+
+typedef struct {
+    TIM_TypeDef *Instance;
+    TIM_Base_InitTypeDef Init;
+    HAL_TIM_ActiveChannel Channel;
+} TIM_HandleTypeDef;
+
+typedef struct {
+    uint32_t OCMode;
+    uint32_t Pulse;
+    uint32_t OCPolarity;
+    uint32_t OCFastMode;
+} TIM_OC_InitTypeDef;
+
+typedef struct {
+    uint32_t MasterOutputTrigger;
+    uint32_t MasterOutputTrigger2;
+    uint32_t MasterSlaveMode;
+} TIM_MasterConfigTypeDef;
+
+extern TIM_TypeDef simTim1, simTim12;
+#define TIM1 (&simTim1)
+#define TIM12 (&simTim12)
+
+#define TIM_CHANNEL_1 0x00000000U
+#define TIM_CHANNEL_2 0x00000004U
+#define TIM_CHANNEL_3 0x00000008U
+#define TIM_CHANNEL_4 0x0000000CU
+
+#define TIM_OCMODE_PWM1 0x00000060U
+#define TIM_OCMODE_PWM2 0x00000070U
+#define TIM_OCPOLARITY_HIGH 0x00000000U
+#define TIM_OCFAST_DISABLE 0x00000000U
+#define TIM_TRGO_RESET 0x00000000U
+#define TIM_TRGO2_RESET 0x00000000U
+#define TIM_TRGO2_OC4REF 0x00700000U
+#define TIM_MASTERSLAVEMODE_DISABLE 0x00000000U
+
+#define __HAL_TIM_ENABLE_IT(h, it) ((h)->Instance->DIER |= (it))
+#define __HAL_TIM_DISABLE_IT(h, it) ((h)->Instance->DIER &= ~(it))
+// Compare flags are not modelled, the sim raises CC3 only at the match
+#define __HAL_TIM_CLEAR_IT(h, it) ((void) (h), (void) (it))
+#define __HAL_TIM_GET_COUNTER(h) ((h)->Instance->CNT)
+#define __HAL_TIM_GET_AUTORELOAD(h) ((h)->Instance->ARR)
+#define __HAL_TIM_SET_AUTORELOAD(h, v) \
+    do { (h)->Instance->ARR = (v); (h)->Init.Period = (v); } while (0)
+#define __HAL_TIM_CCR(h, ch) (*(&(h)->Instance->CCR1 + (ch) / 4))
+#define __HAL_TIM_GET_COMPARE(h, ch) __HAL_TIM_CCR(h, ch)
+#define __HAL_TIM_SET_COMPARE(h, ch, v) (__HAL_TIM_CCR(h, ch) = (v))
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t channel);
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *config, uint32_t channel);
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, const TIM_MasterConfigTypeDef *config);
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim);
+void HAL_TIM_PWM_PulseFinishedCallback(TIM_HandleTypeDef *htim);
+
+// ---- GPDMA ----
+
+typedef struct {
+    __IO uint32_t CBR1; // BNDT: bytes left in the block
+} DMA_Channel_TypeDef;
+
+typedef struct {
+    DMA_Channel_TypeDef *Instance;
+} DMA_HandleTypeDef;
+
+typedef struct {
+    uint32_t Request;
+    uint32_t BlkHWRequest;
+    uint32_t Direction;
+    uint32_t SrcInc;
+    uint32_t DestInc;
+    uint32_t SrcDataWidth;
+    uint32_t DestDataWidth;
+    uint32_t SrcBurstLength;
+    uint32_t DestBurstLength;
+    uint32_t TransferAllocatedPort;
+    uint32_t TransferEventMode;
+    uint32_t Mode;
+} DMA_InitTypeDef;
+
+typedef struct {
+    uint32_t TriggerPolarity;
+} DMA_TriggerConfTypeDef;
+
+typedef struct {
+    uint32_t DataExchange;
+    uint32_t DataAlignment;
+} DMA_DataHandlingConfTypeDef;
+
+typedef struct {
+    uint32_t NodeType;
+    DMA_InitTypeDef Init;
+    DMA_TriggerConfTypeDef TriggerConfig;
+    DMA_DataHandlingConfTypeDef DataHandlingConfig;
+} DMA_NodeConfTypeDef;
+
+typedef struct {
+    uint32_t width; // Destination width in bytes
+} DMA_NodeTypeDef;
+
+typedef struct {
+    DMA_NodeTypeDef *head;
+    uint8_t circular;
+} DMA_QListTypeDef;
+
+#define DMA_GPDMA_LINEAR_NODE 0x00010000U
+#define GPDMA1_REQUEST_ADC1 0U
+#define DMA_BREQ_SINGLE_BURST 0x00000000U
+#define DMA_PERIPH_TO_MEMORY 0x00000000U
+#define DMA_SINC_FIXED 0x00000000U
+#define DMA_DINC_INCREMENTED 0x00080000U
+#define DMA_SRC_DATAWIDTH_HALFWORD 0x00000001U
+#define DMA_SRC_DATAWIDTH_WORD 0x00000002U
+#define DMA_DEST_DATAWIDTH_HALFWORD 0x00010000U
+#define DMA_DEST_DATAWIDTH_WORD 0x00020000U
+#define DMA_SRC_ALLOCATED_PORT0 0x00000000U
+#define DMA_DEST_ALLOCATED_PORT0 0x00000000U
+#define DMA_TCEM_LAST_LL_ITEM_TRANSFER 0xC0000000U
+#define DMA_NORMAL 0x00000000U
+#define DMA_TRIG_POLARITY_MASKED 0x00000000U
+#define DMA_EXCHANGE_NONE 0x00000000U
+#define DMA_DATA_RIGHTALIGN_ZEROPADDED 0x00000000U
+
+#define __HAL_DMA_GET_COUNTER(h) ((h)->Instance->CBR1 & 0xFFFFU)
+
+HAL_StatusTypeDef HAL_DMAEx_List_ResetQ(DMA_QListTypeDef *list);
+HAL_StatusTypeDef HAL_DMAEx_List_BuildNode(const DMA_NodeConfTypeDef *config, DMA_NodeTypeDef *node);
+HAL_StatusTypeDef HAL_DMAEx_List_InsertNode(DMA_QListTypeDef *list, DMA_NodeTypeDef *prev, DMA_NodeTypeDef *node);
+HAL_StatusTypeDef HAL_DMAEx_List_SetCircularMode(DMA_QListTypeDef *list);
+HAL_StatusTypeDef HAL_DMAEx_List_LinkQ(DMA_HandleTypeDef *hdma, DMA_QListTypeDef *list);
+HAL_StatusTypeDef HAL_DMAEx_List_UnLinkQ(DMA_HandleTypeDef *hdma);
+
+// ---- ADC ----
+
+typedef struct {
+    __IO uint32_t ISR;
+    __IO uint32_t IER;
+    __IO uint32_t TR1; // LT1 [11:0], AWDFILT1 [14:12], HT1 [27:16]
+    __IO uint32_t TR2; // LT2 [7:0], HT2 [23:16], against bits [11:4] of the result
+    __IO uint32_t TR3; // Same as TR2
+} ADC_TypeDef;
+
+#define ADC_IT_AWD1 (1UL << 7)
+#define ADC_IT_AWD2 (1UL << 8)
+#define ADC_IT_AWD3 (1UL << 9)
+#define ADC_FLAG_AWD2 ADC_IT_AWD2
+#define ADC_FLAG_AWD3 ADC_IT_AWD3
+#define ADC_TR1_AWDFILT1_Pos 12U
+#define ADC_TR1_HT1_Pos 16U
+
+typedef struct {
+    uint32_t Ratio;
+    uint32_t RightBitShift;
+    uint32_t TriggeredMode;
+    uint32_t OversamplingStopReset;
+} ADC_OversamplingTypeDef;
+
+typedef struct {
+    uint32_t ClockPrescaler;
+    uint32_t Resolution;
+    uint32_t DataAlign;
+    uint32_t ScanConvMode;
+    uint32_t EOCSelection;
+    FunctionalState LowPowerAutoWait;
+    FunctionalState ContinuousConvMode;
+    uint32_t NbrOfConversion;
+    FunctionalState DiscontinuousConvMode;
+    uint32_t ExternalTrigConv;
+    uint32_t ExternalTrigConvEdge;
+    FunctionalState DMAContinuousRequests;
+    uint32_t SamplingMode;
+    uint32_t Overrun;
+    FunctionalState OversamplingMode;
+    ADC_OversamplingTypeDef Oversampling;
+} ADC_InitTypeDef;
+
+typedef struct {
+    ADC_TypeDef *Instance;
+    ADC_InitTypeDef Init;
+    DMA_HandleTypeDef *DMA_Handle;
+    __IO uint32_t ErrorCode;
+} ADC_HandleTypeDef;
+
+typedef struct {
+    uint32_t Channel;
+    uint32_t Rank;
+    uint32_t SamplingTime;
+    uint32_t SingleDiff;
+    uint32_t OffsetNumber;
+    uint32_t Offset;
+} ADC_ChannelConfTypeDef;
+
+typedef struct {
+    uint32_t Mode;
+    uint32_t DMAAccessMode;
+    uint32_t TwoSamplingDelay;
+} ADC_MultiModeTypeDef;
+
+extern ADC_TypeDef simAdc1, simAdc2;
+#define ADC1 (&simAdc1)
+#define ADC2 (&simAdc2)
+
+#define ADC_CLOCK_ASYNC_DIV4 0x00020000U
+#define ADC_RESOLUTION_12B 0x00000000U
+#define ADC_DATAALIGN_RIGHT 0x00000000U
+#define ADC_SCAN_DISABLE 0x00000000U
+#define ADC_EOC_SINGLE_CONV 0x00000004U
+#define ADC_SAMPLING_MODE_NORMAL 0x00000000U
+#define ADC_OVR_DATA_OVERWRITTEN 0x00001000U
+
+// Register encodings of SMPx: 2.5, 6.5, 12.5, 24.5, 47.5, 92.5, 247.5 and 640.5 cycles
+#define ADC_SAMPLETIME_2CYCLES_5 0U
+#define ADC_SAMPLETIME_6CYCLES_5 1U
+#define ADC_SAMPLETIME_12CYCLES_5 2U
+#define ADC_SAMPLETIME_24CYCLES_5 3U
+#define ADC_SAMPLETIME_47CYCLES_5 4U
+#define ADC_SAMPLETIME_92CYCLES_5 5U
+#define ADC_SAMPLETIME_247CYCLES_5 6U
+#define ADC_SAMPLETIME_640CYCLES_5 7U
+
+#define ADC_CFGR2_OVSR_Pos 2U
+#define ADC_CFGR2_OVSS_Pos 5U
+#define ADC_TRIGGEREDMODE_SINGLE_TRIGGER 0x00000000U
+#define ADC_REGOVERSAMPLING_CONTINUED_MODE 0x00000000U
+
+#define ADC_SOFTWARE_START 0x00000001U
+#define ADC_EXTERNALTRIG_T1_TRGO2 0x00000040U
+#define ADC_EXTERNALTRIGCONVEDGE_NONE 0x00000000U
+#define ADC_EXTERNALTRIGCONVEDGE_RISING 0x00000400U
+
+#define ADC_CHANNEL_0 0x04000001U
+#define ADC_REGULAR_RANK_1 0x00000006U
+#define ADC_SINGLE_ENDED 0x7FU
+#define ADC_OFFSET_NONE 0x08U
+
+#define ADC_MODE_INDEPENDENT 0x00000000U
+#define ADC_DUALMODE_INTERL 0x00000007U
+#define ADC_DMAACCESSMODE_DISABLED 0x00000000U
+#define ADC_DMAACCESSMODE_12_10_BITS 0x00008000U
+#define ADC_TWOSAMPLINGDELAY_7CYCLES 0x00000600U
+
+#define HAL_ADC_ERROR_OVR 0x02U
+
+#define LL_ADC_AWD1 0U
+#define LL_ADC_AWD2 1U
+#define LL_ADC_AWD3 2U
+
+#define __HAL_ADC_ENABLE_IT(h, it) ((h)->Instance->IER |= (it))
+#define __HAL_ADC_DISABLE_IT(h, it) ((h)->Instance->IER &= ~(it))
+#define __HAL_ADC_CLEAR_FLAG(h, f) ((h)->Instance->ISR &= ~(f))
+
+static inline void LL_ADC_ConfigAnalogWDThresholds(ADC_TypeDef *adc, uint32_t awd, uint32_t high, uint32_t low) {
+    if (awd == LL_ADC_AWD2)
+        adc->TR2 = (high << ADC_TR1_HT1_Pos) | low;
+    else if (awd == LL_ADC_AWD3)
+        adc->TR3 = (high << ADC_TR1_HT1_Pos) | low;
+    else
+        adc->TR1 = (adc->TR1 & (7UL << ADC_TR1_AWDFILT1_Pos)) | (high << ADC_TR1_HT1_Pos) | low;
+}
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, const ADC_ChannelConfTypeDef *config);
+HAL_StatusTypeDef HAL_ADC_Start_IT(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *data, uint32_t length);
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADCEx_MultiModeConfigChannel(ADC_HandleTypeDef *hadc, const ADC_MultiModeTypeDef *config);
+HAL_StatusTypeDef HAL_ADCEx_MultiModeStart_DMA(ADC_HandleTypeDef *hadc, uint32_t *data, uint32_t length);
+HAL_StatusTypeDef HAL_ADCEx_MultiModeStop_DMA(ADC_HandleTypeDef *hadc);
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADCEx_LevelOutOfWindow2Callback(ADC_HandleTypeDef *hadc);
+void HAL_ADCEx_LevelOutOfWindow3Callback(ADC_HandleTypeDef *hadc);
+void HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc);
+
+// ---- UART ----
+
+typedef enum {
+    HAL_UART_STATE_READY = 0x20U,
+    HAL_UART_STATE_BUSY_RX = 0x22U
+} HAL_UART_StateTypeDef;
+
+#define HAL_UART_RXEVENT_TC 0x00U
+#define HAL_UART_RXEVENT_HT 0x01U
+#define HAL_UART_RXEVENT_IDLE 0x02U
+
+typedef struct {
+    __IO HAL_UART_StateTypeDef RxState;
+    __IO uint32_t RxEventType;
+    uint8_t *pRxBuffPtr;
+    uint16_t RxXferSize;
+} UART_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *data, uint16_t size);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *data, uint16_t size);
+uint32_t HAL_UARTEx_GetRxEventType(const UART_HandleTypeDef *huart);
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t size);
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+
+#ifdef __cplusplus
+}
+#endif
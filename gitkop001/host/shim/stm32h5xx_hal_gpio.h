@@ -0,0 +1,3 @@
+#pragma once
+
+#include "stm32h5xx_hal.h"
@@ -0,0 +1,657 @@
+#include "sim.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "main.h"
+#include "adc.h"
+#include "tim.h"
+#include "usart.h"
+#include "detector.h"
+
+// What CubeMX generates in main.c, adc.c, tim.c and usart.c
+DWT_Type simDwt;
+CoreDebug_Type simCoreDebug;
+GPIO_TypeDef simGpioA, simGpioB, simGpioC;
+TIM_TypeDef simTim1, simTim12;
+ADC_TypeDef simAdc1, simAdc2;
+static DMA_Channel_TypeDef simDma5;
+
+uint32_t SystemCoreClock = 250000000;
+
+ADC_HandleTypeDef hadc1;
+ADC_HandleTypeDef hadc2;
+DMA_HandleTypeDef handle_GPDMA1_Channel5;
+DMA_NodeTypeDef Node_GPDMA1_Channel5;
+DMA_QListTypeDef List_GPDMA1_Channel5;
+TIM_HandleTypeDef htim1;
+TIM_HandleTypeDef htim12;
+UART_HandleTypeDef huart1;
+
+extern Detector_t detector;
+
+// Time is kept in picoseconds: the CPU, TIM and ADC clocks all divide it evenly
+#define PS_PER_CPU_CYCLE 4000ULL    // 250 MHz HCLK
+#define PS_PER_ADC_CYCLE 16000ULL   // HCLK / 4
+#define PS_PER_MS 1000000000ULL
+#define PS_PER_UART_BYTE 5000000ULL // 10 bits at 2 Mbaud
+#define ADC_CONVERSION_HALF_CYCLES 25 // 12.5 cycles for 12 bits
+
+// SMPx encodings 0..7 in half ADC clock cycles
+static const uint16_t samplingHalfCycles[8] = { 5, 13, 25, 49, 95, 185, 495, 1281 };
+
+static struct {
+    Sim_Config_t config;
+    Sim_Stats_t stats;
+    Coil_t coil;
+    uint64_t now;
+
+    // TIM1: CCR3 is the transmit pulse, CCR4 OC4REF the burst trigger. ARR
+    // and both compares are preloaded, the update event latches them.
+    uint8_t timRunning;
+    uint64_t periodStart;
+    uint32_t arr;
+    uint32_t ccr3;
+    uint32_t ccr4;
+    uint8_t cc3Done;         // CC3 already matched in this period
+    uint8_t trgo2Oc4;
+    uint8_t triggerDone;     // OC4REF already rose in this period
+    double scale;            // Target coupling of the current pulse
+    uint8_t near;            // Target inside the pass window
+    uint8_t passAlarm;
+    Replay_t *source;        // Capture feeding the current pulse, NULL for the coil model
+
+    // ADC1 (+ ADC2) and the GPDMA channel
+    uint8_t adcRunning;
+    uint8_t adcTriggered;    // External trigger from TRGO2, otherwise continuous
+    uint8_t adcBurst;        // Converting after the trigger
+    uint8_t dual;
+    uint8_t ratioLog2;
+    uint8_t shift;
+    uint16_t smpHalfCycles;
+    uint64_t adcPeriod;      // One DMA half word
+    uint64_t adcNext;
+    uint16_t *dst;
+    uint32_t length;         // Half words
+    uint32_t index;
+    uint8_t circular;
+    uint8_t awdCount;
+    DMA_QListTypeDef *list;
+
+    // USART1
+    uint8_t txBusy;
+    const uint8_t *txData;
+    uint16_t txSize;
+    uint64_t txDone;
+    uint16_t command;
+
+    double hostExit;         // Host time the firmware got control back, 0 before it first had it
+} sim;
+
+static void Sim_Irq(void) {
+    simDwt.CYCCNT = (uint32_t) (sim.now / PS_PER_CPU_CYCLE);
+    simTim1.CNT = (uint32_t) ((sim.now - sim.periodStart) / ((simTim1.PSC + 1) * PS_PER_CPU_CYCLE));
+    sim.stats.interrupts++;
+}
+
+static uint64_t Sim_TimTicks(uint32_t ticks) {
+    return (uint64_t) ticks * (simTim1.PSC + 1) * PS_PER_CPU_CYCLE;
+}
+
+// Raised cosine pass of the target over the coil, centred in every sweep period
+static double Sim_Scale(double seconds, uint8_t *near) {
+    if (sim.config.sweepPeriod <= 0.0) {
+        *near = 1;
+        return 1.0;
+    }
+
+    double width = sim.config.sweepWidth;
+    double phase = fmod(seconds, sim.config.sweepPeriod) - sim.config.sweepPeriod / 2;
+    *near = fabs(phase) < width;
+    if (fabs(phase) >= width / 2)
+        return 0.0;
+    return 0.5 * (1.0 + cos(2.0 * M_PI * phase / width));
+}
+
+// The detector state after the processing of a period is the verdict on its pulse
+static void Sim_Account(void) {
+    Sim_Stats_t *stats = &sim.stats;
+    if (stats->pulses < sim.config.settle)
+        return;
+
+    uint8_t alarm = detector.alarm;
+    if (sim.near)
+        sim.passAlarm |= alarm;
+    if (sim.scale >= 0.5) {
+        stats->targetPulses++;
+        stats->hits += alarm;
+    } else if (!sim.near) {
+        stats->clearPulses++;
+        stats->falseAlarms += alarm;
+    }
+}
+
+static void Sim_Update(void) {
+    if (sim.timRunning) {
+        Sim_Account();
+        sim.stats.pulses++;
+        if (sim.stats.pulses >= sim.config.pulses && sim.config.done) {
+            sim.stats.seconds = sim.now * 1e-12;
+            sim.config.done();
+        }
+    }
+
+    sim.periodStart = sim.now;
+    sim.cc3Done = 0;
+    sim.arr = simTim1.ARR;
+    sim.ccr3 = simTim1.CCR3;
+    sim.ccr4 = simTim1.CCR4;
+    sim.triggerDone = 0;
+
+    uint8_t near;
+    if (sim.config.replay && !sim.config.replayMetal)
+        sim.scale = near = sim.config.replayTarget;
+    else
+        sim.scale = Sim_Scale(sim.now * 1e-12, &near);
+    if (sim.near && !near && sim.config.sweepPeriod > 0.0) {
+        if (sim.stats.pulses > sim.config.settle) {
+            sim.stats.passes++;
+            sim.stats.passesDetected += sim.passAlarm;
+        }
+        sim.passAlarm = 0;
+    }
+    sim.near = near;
+
+    if (sim.config.replay) {
+        // A capture is all or nothing, the pass is on it while the coupling is at least half
+        sim.source = sim.config.replayMetal && sim.scale >= 0.5 ? sim.config.replayMetal : sim.config.replay;
+        if (Replay_Next(sim.source) != 0)
+            exit(1);
+        if (sim.config.replayMetal)
+            sim.scale = sim.scale >= 0.5;
+    } else {
+        Coil_Pulse(&sim.coil, Sim_TimTicks(sim.ccr3) * 1e-12, sim.scale);
+    }
+    if (sim.config.pulseHook)
+        sim.config.pulseHook((uint32_t) sim.stats.pulses, sim.now * 1e-12, sim.scale, sim.near);
+}
+
+// One DMA half word: a conversion, or 2^n of them averaged by the oversampler
+static uint16_t Sim_Convert(uint64_t done) {
+    uint64_t conversion = (uint64_t) (sim.smpHalfCycles + ADC_CONVERSION_HALF_CYCLES) * PS_PER_ADC_CYCLE / 2;
+    uint32_t count = 1U << sim.ratioLog2;
+    uint32_t sum = 0;
+    for (uint32_t k = 0; k < count; k++) {
+        // The input is held at the end of the sampling phase
+        uint64_t held = done - (count - 1 - k) * conversion - ADC_CONVERSION_HALF_CYCLES * PS_PER_ADC_CYCLE / 2;
+        double t = held > sim.periodStart ? (held - sim.periodStart) * 1e-12 : 0.0;
+        double volts = sim.source ? Replay_Volts(sim.source, t) : Coil_Volts(&sim.coil, t);
+        double lsb = volts / sim.coil.p.vRef * 4096.0;
+        if (sim.config.adcNoise > 0.0)
+            lsb += sim.config.adcNoise * Coil_Gauss(&sim.coil);
+        int32_t code = (int32_t) floor(lsb);
+        if (code < 0)
+            code = 0;
+        if (code > 4095)
+            code = 4095;
+        sum += (uint32_t) code;
+    }
+    return (uint16_t) (sum >> sim.shift);
+}
+
+static void Sim_Awd(uint16_t code) {
+    if (simAdc1.IER & ADC_IT_AWD1) {
+        uint32_t low = simAdc1.TR1 & 0xFFF;
+        uint32_t high = (simAdc1.TR1 >> ADC_TR1_HT1_Pos) & 0xFFF;
+        uint8_t filter = ((simAdc1.TR1 >> ADC_TR1_AWDFILT1_Pos) & 7) + 1;
+        if (code >= low && code <= high) {
+            sim.awdCount = 0;
+        } else if (++sim.awdCount >= filter) {
+            sim.awdCount = 0;
+            Sim_Irq();
+            HAL_ADC_LevelOutOfWindowCallback(&hadc1);
+        }
+    }
+
+    // AWD2 and AWD3: 8 bit thresholds on the top bits of the result, no
+    // filter. The flags latch whether or not the interrupt is enabled, the HAL
+    // handler clears them after the callback.
+    uint32_t top = code >> 4;
+    if (top < (simAdc1.TR2 & 0xFF) || top > ((simAdc1.TR2 >> ADC_TR1_HT1_Pos) & 0xFF))
+        simAdc1.ISR |= ADC_FLAG_AWD2;
+    if (top < (simAdc1.TR3 & 0xFF) || top > ((simAdc1.TR3 >> ADC_TR1_HT1_Pos) & 0xFF))
+        simAdc1.ISR |= ADC_FLAG_AWD3;
+    if (simAdc1.IER & simAdc1.ISR & ADC_FLAG_AWD2) {
+        Sim_Irq();
+        HAL_ADCEx_LevelOutOfWindow2Callback(&hadc1);
+        simAdc1.ISR &= ~ADC_FLAG_AWD2;
+    }
+    if (simAdc1.IER & simAdc1.ISR & ADC_FLAG_AWD3) {
+        Sim_Irq();
+        HAL_ADCEx_LevelOutOfWindow3Callback(&hadc1);
+        simAdc1.ISR &= ~ADC_FLAG_AWD3;
+    }
+}
+
+// Returns 1 when the sample ended in a callback
+static int Sim_Sample(void) {
+    uint16_t code = Sim_Convert(sim.now);
+    sim.dst[sim.index++] = code;
+    sim.stats.samples++;
+    simDma5.CBR1 = (sim.length - sim.index) * 2;
+    sim.adcNext += sim.adcPeriod;
+
+    int delivered = 0;
+    // The watchdogs only watch the master
+    if (!sim.dual || (sim.index & 1)) {
+        uint64_t before = sim.stats.interrupts;
+        Sim_Awd(code);
+        delivered = sim.stats.interrupts != before;
+    }
+
+    if (sim.index == sim.length / 2) {
+        Sim_Irq();
+        HAL_ADC_ConvHalfCpltCallback(&hadc1);
+        return 1;
+    }
+    if (sim.index == sim.length) {
+        if (sim.circular) {
+            sim.index = 0;
+            simDma5.CBR1 = sim.length * 2;
+        } else {
+            sim.adcRunning = 0;
+            sim.adcBurst = 0;
+        }
+        Sim_Irq();
+        HAL_ADC_ConvCpltCallback(&hadc1);
+        return 1;
+    }
+    return delivered;
+}
+
+/**
+ * @brief Advance to the next peripheral event and handle it.
+ * * @param until Latest time the event may have, ps.
+ * @return 1 if a callback ran, 0 if the event raised none, -1 if there was no event until then.
+ */
+static int Sim_Step(uint64_t until) {
+    enum { EV_NONE, EV_UPDATE, EV_CC3, EV_TRIGGER, EV_SAMPLE, EV_TX } event = EV_NONE;
+    uint64_t at = UINT64_MAX;
+
+    if (sim.timRunning) {
+        at = sim.periodStart + Sim_TimTicks(sim.arr + 1);
+        event = EV_UPDATE;
+
+        uint64_t cc3 = sim.periodStart + Sim_TimTicks(sim.ccr3);
+        if ((simTim1.DIER & TIM_IT_CC3) && !sim.cc3Done && cc3 < at) {
+            at = cc3;
+            event = EV_CC3;
+        }
+
+        uint64_t trigger = sim.periodStart + Sim_TimTicks(sim.ccr4);
+        if (sim.adcRunning && sim.adcTriggered && !sim.adcBurst && sim.trgo2Oc4 && !sim.triggerDone) {
+            // Armed after OC4REF rose: the next period starts the burst
+            if (trigger < sim.now)
+                sim.triggerDone = 1;
+            else if (trigger < at) {
+                at = trigger;
+                event = EV_TRIGGER;
+            }
+        }
+    }
+    if (sim.adcRunning && (!sim.adcTriggered || sim.adcBurst) && sim.adcNext < at) {
+        at = sim.adcNext;
+        event = EV_SAMPLE;
+    }
+    if (sim.txBusy && sim.txDone < at) {
+        at = sim.txDone;
+        event = EV_TX;
+    }
+
+    if (event == EV_NONE || at > until)
+        return -1;
+    sim.now = at;
+    simDwt.CYCCNT = (uint32_t) (sim.now / PS_PER_CPU_CYCLE);
+
+    switch (event) {
+    case EV_UPDATE:
+        Sim_Update();
+        Sim_Irq();
+        HAL_TIM_PeriodElapsedCallback(&htim1);
+        return 1;
+    case EV_CC3:
+        sim.cc3Done = 1;
+        Sim_Irq();
+        htim1.Channel = HAL_TIM_ACTIVE_CHANNEL_3;
+        HAL_TIM_PWM_PulseFinishedCallback(&htim1);
+        htim1.Channel = HAL_TIM_ACTIVE_CHANNEL_CLEARED;
+        return 1;
+    case EV_TRIGGER:
+        sim.triggerDone = 1;
+        sim.adcBurst = 1;
+        sim.adcNext = sim.now + sim.adcPeriod;
+        return 0;
+    case EV_SAMPLE:
+        return Sim_Sample();
+    case EV_TX:
+        sim.txBusy = 0;
+        if (sim.config.uart)
+            fwrite(sim.txData, 1, sim.txSize, sim.config.uart);
+        if (sim.config.uartHook)
+            sim.config.uartHook(sim.txData, sim.txSize);
+        sim.stats.uartBytes += sim.txSize;
+        Sim_Irq();
+        HAL_UART_TxCpltCallback(&huart1);
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// The next command line arrives as one idle line event
+static int Sim_Command(void) {
+    if (sim.command >= sim.config.commandCount || huart1.RxState != HAL_UART_STATE_BUSY_RX)
+        return 0;
+
+    const char *line = sim.config.commands[sim.command++];
+    uint16_t len = 0;
+    while (line[len] && len < huart1.RxXferSize - 1) {
+        huart1.pRxBuffPtr[len] = (uint8_t) line[len];
+        len++;
+    }
+    huart1.pRxBuffPtr[len++] = '\n';
+    huart1.RxState = HAL_UART_STATE_READY;
+    huart1.RxEventType = HAL_UART_RXEVENT_IDLE;
+    Sim_Irq();
+    HAL_UARTEx_RxEventCallback(&huart1, len);
+    return 1;
+}
+
+// Host time between leaving the model and entering it again is firmware time
+static double Sim_HostSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void Sim_Enter(void) {
+    double host = Sim_HostSeconds();
+    if (sim.hostExit > 0.0)
+        sim.stats.firmwareSeconds += host - sim.hostExit;
+}
+
+static void Sim_Exit(void) {
+    sim.hostExit = Sim_HostSeconds();
+}
+
+void Sim_Wfi(void) {
+    Sim_Enter();
+    if (Sim_Command()) {
+        Sim_Exit();
+        return;
+    }
+    // Nothing left to wake the core would be a firmware bug, not a long sleep
+    while (1) {
+        int step = Sim_Step(UINT64_MAX);
+        if (step > 0)
+            break;
+        if (step < 0) {
+            fprintf(stderr, "sim: WFI with no interrupt source running\n");
+            exit(1);
+        }
+    }
+    Sim_Exit();
+}
+
+void Sim_Init(const Sim_Config_t *config) {
+    memset(&sim, 0, sizeof(sim));
+    sim.config = *config;
+    Coil_Init(&sim.coil, &config->coil, config->seed);
+
+    // As MX_TIM1_Init, MX_TIM12_Init, MX_ADC1_Init and MX_USART1_UART_Init leave them
+    htim1.Instance = TIM1;
+    htim1.Init.Prescaler = 4;
+    htim1.Init.Period = 50749;
+    simTim1.PSC = 4;
+    simTim1.ARR = 50749;
+    simTim1.CCR3 = 750;
+    htim12.Instance = TIM12;
+    htim12.Init.Prescaler = 249;
+    htim12.Init.Period = 999;
+    simTim12.PSC = 249;
+    simTim12.ARR = 999;
+
+    handle_GPDMA1_Channel5.Instance = &simDma5;
+    hadc1.Instance = ADC1;
+    hadc1.DMA_Handle = &handle_GPDMA1_Channel5;
+    hadc1.Init.ClockPrescaler = ADC_CLOCK_ASYNC_DIV4;
+    hadc1.Init.Resolution = ADC_RESOLUTION_12B;
+    hadc1.Init.ContinuousConvMode = ENABLE;
+    hadc1.Init.NbrOfConversion = 1;
+    hadc1.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+    hadc1.Init.DMAContinuousRequests = ENABLE;
+    hadc1.Init.Overrun = ADC_OVR_DATA_OVERWRITTEN;
+    simAdc1.TR1 = (3UL << ADC_TR1_AWDFILT1_Pos) | (4095UL << ADC_TR1_HT1_Pos) | 2500;
+    simAdc1.TR2 = (255UL << ADC_TR1_HT1_Pos) | (1792 >> 4);
+    simAdc1.TR3 = (255UL << ADC_TR1_HT1_Pos) | (1408 >> 4);
+    simAdc1.IER |= ADC_IT_AWD1 | ADC_IT_AWD2 | ADC_IT_AWD3;
+    sim.smpHalfCycles = samplingHalfCycles[ADC_SAMPLETIME_2CYCLES_5];
+
+    huart1.RxState = HAL_UART_STATE_READY;
+}
+
+const Sim_Stats_t *Sim_Stats(void) {
+    sim.stats.seconds = sim.now * 1e-12;
+    return &sim.stats;
+}
+
+void Error_Handler(void) {
+    fprintf(stderr, "sim: Error_Handler\n");
+    abort();
+}
+
+// ---- HAL common ----
+
+uint32_t HAL_GetTick(void) {
+    return (uint32_t) (sim.now / PS_PER_MS);
+}
+
+// Interrupts keep coming while the core spins
+void HAL_Delay(uint32_t delay) {
+    Sim_Enter();
+    uint64_t until = sim.now + (uint64_t) delay * PS_PER_MS;
+    while (Sim_Step(until) >= 0) {
+    }
+    sim.now = until;
+    Sim_Exit();
+}
+
+uint32_t HAL_RCC_GetHCLKFreq(void) {
+    return SystemCoreClock;
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void) {
+    return SystemCoreClock;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state) {
+    if (state)
+        port->ODR |= pin;
+    else
+        port->ODR &= ~(uint32_t) pin;
+}
+
+// ---- TIM ----
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t channel) {
+    (void) htim;
+    (void) channel;
+    return HAL_OK;
+}
+
+// The buzzer timer only drives the pin, its updates are not modelled
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim) {
+    if (htim->Instance == TIM1 && !sim.timRunning) {
+        Sim_Update();
+        sim.timRunning = 1;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *config, uint32_t channel) {
+    __HAL_TIM_SET_COMPARE(htim, channel, config->Pulse);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, const TIM_MasterConfigTypeDef *config) {
+    if (htim->Instance == TIM1)
+        sim.trgo2Oc4 = config->MasterOutputTrigger2 == TIM_TRGO2_OC4REF;
+    return HAL_OK;
+}
+
+// ---- GPDMA ----
+
+HAL_StatusTypeDef HAL_DMAEx_List_ResetQ(DMA_QListTypeDef *list) {
+    list->head = NULL;
+    list->circular = 0;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_BuildNode(const DMA_NodeConfTypeDef *config, DMA_NodeTypeDef *node) {
+    node->width = config->Init.DestDataWidth == DMA_DEST_DATAWIDTH_WORD ? 4 : 2;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_InsertNode(DMA_QListTypeDef *list, DMA_NodeTypeDef *prev, DMA_NodeTypeDef *node) {
+    (void) prev;
+    list->head = node;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_SetCircularMode(DMA_QListTypeDef *list) {
+    if (!list->head)
+        return HAL_ERROR;
+    list->circular = 1;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_LinkQ(DMA_HandleTypeDef *hdma, DMA_QListTypeDef *list) {
+    (void) hdma;
+    if (!list->head)
+        return HAL_ERROR;
+    sim.list = list;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_UnLinkQ(DMA_HandleTypeDef *hdma) {
+    (void) hdma;
+    sim.list = NULL;
+    return HAL_OK;
+}
+
+// ---- ADC ----
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc) {
+    if (hadc != &hadc1)
+        return HAL_OK;
+
+    sim.adcTriggered = hadc->Init.ExternalTrigConv == ADC_EXTERNALTRIG_T1_TRGO2;
+    if (hadc->Init.OversamplingMode) {
+        sim.ratioLog2 = (uint8_t) ((hadc->Init.Oversampling.Ratio >> ADC_CFGR2_OVSR_Pos) + 1);
+        sim.shift = (uint8_t) (hadc->Init.Oversampling.RightBitShift >> ADC_CFGR2_OVSS_Pos);
+    } else {
+        sim.ratioLog2 = 0;
+        sim.shift = 0;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, const ADC_ChannelConfTypeDef *config) {
+    if (config->SamplingTime > ADC_SAMPLETIME_640CYCLES_5)
+        return HAL_ERROR;
+    if (hadc == &hadc1)
+        sim.smpHalfCycles = samplingHalfCycles[config->SamplingTime];
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADCEx_MultiModeConfigChannel(ADC_HandleTypeDef *hadc, const ADC_MultiModeTypeDef *config) {
+    (void) hadc;
+    sim.dual = config->Mode == ADC_DUALMODE_INTERL;
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef Sim_AdcStart(uint32_t *data, uint32_t halfWords) {
+    if (sim.adcRunning)
+        return HAL_BUSY;
+    if (!sim.list || !halfWords)
+        return HAL_ERROR;
+
+    sim.dst = (uint16_t *) data;
+    sim.length = halfWords;
+    sim.index = 0;
+    sim.circular = sim.list->circular;
+    sim.awdCount = 0;
+    simDma5.CBR1 = halfWords * 2;
+
+    sim.adcPeriod = ((uint64_t) (sim.smpHalfCycles + ADC_CONVERSION_HALF_CYCLES) * PS_PER_ADC_CYCLE / 2) << sim.ratioLog2;
+    if (sim.dual)
+        sim.adcPeriod /= 2;
+    sim.adcBurst = 0;
+    sim.adcNext = sim.now + sim.adcPeriod;
+    sim.adcRunning = 1;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *data, uint32_t length) {
+    (void) hadc;
+    return Sim_AdcStart(data, length);
+}
+
+HAL_StatusTypeDef HAL_ADCEx_MultiModeStart_DMA(ADC_HandleTypeDef *hadc, uint32_t *data, uint32_t length) {
+    (void) hadc;
+    return Sim_AdcStart(data, length * 2);
+}
+
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef *hadc) {
+    (void) hadc;
+    sim.adcRunning = 0;
+    sim.adcBurst = 0;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADCEx_MultiModeStop_DMA(ADC_HandleTypeDef *hadc) {
+    return HAL_ADC_Stop_DMA(hadc);
+}
+
+HAL_StatusTypeDef HAL_ADC_Start_IT(ADC_HandleTypeDef *hadc) {
+    (void) hadc;
+    return sim.adcRunning ? HAL_BUSY : HAL_OK;
+}
+
+// ---- UART ----
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *data, uint16_t size) {
+    (void) huart;
+    if (sim.txBusy)
+        return HAL_BUSY;
+    sim.txBusy = 1;
+    sim.txData = data;
+    sim.txSize = size;
+    sim.txDone = sim.now + size * PS_PER_UART_BYTE;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *data, uint16_t size) {
+    if (huart->RxState != HAL_UART_STATE_READY)
+        return HAL_BUSY;
+    huart->pRxBuffPtr = data;
+    huart->RxXferSize = size;
+    huart->RxState = HAL_UART_STATE_BUSY_RX;
+    return HAL_OK;
+}
+
+uint32_t HAL_UARTEx_GetRxEventType(const UART_HandleTypeDef *huart) {
+    return huart->RxEventType;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "coil.h"
+#include "replay.h"
+
+// Event driven model of the peripherals GitKop.c runs on: TIM1 periods,
+// the ADC and its GPDMA channel, the analog watchdog and USART1. Simulated
+// time only moves inside __WFI and HAL_Delay, the firmware's own code takes
+// no simulated time, so every block is processed before the next one lands.
+typedef struct {
+    Coil_Params_t coil;
+    uint64_t seed;
+    uint64_t pulses;          // TIM1 periods to run, then done is called
+    uint64_t settle;          // Pulses left out of the statistics while the filters settle
+    double sweepPeriod;       // s, one target pass every sweepPeriod, 0 keeps the target in place
+    double sweepWidth;        // s, length of a pass
+    double adcNoise;          // LSB rms added by the converter
+    Replay_t *replay;         // Capture played back in place of the coil model, NULL for the model
+    Replay_t *replayMetal;    // With replay: capture with metal, played while a pass has the target over the coil
+    uint8_t replayTarget;     // Without replayMetal: the replay has metal near the coil, the label for the statistics
+    FILE *uart;               // USART1 TX bytes, the stream the plotter reads, NULL drops them
+    char **commands;          // Command lines sent one by one once the main loop is idle
+    uint16_t commandCount;
+    void (*done)(void);       // Called from inside the firmware, must not return
+    // Called at every TIM1 update with the number the firmware gives the
+    // period, its start time and the target coupling it gets
+    void (*pulseHook)(uint32_t pulse, double seconds, double scale, uint8_t near);
+    void (*uartHook)(const uint8_t *data, uint16_t size); // Every USART1 TX transfer
+} Sim_Config_t;
+
+typedef struct {
+    uint64_t pulses;          // TIM1 periods
+    uint64_t samples;         // Half words written by the ADC DMA
+    uint64_t interrupts;      // HAL callbacks delivered
+    uint64_t uartBytes;
+    uint64_t targetPulses;    // Pulses with the target at least half coupled
+    uint64_t hits;            // of those, with the detector alarm on
+    uint64_t clearPulses;     // Pulses without any target
+    uint64_t falseAlarms;     // of those, with the detector alarm on
+    uint32_t passes;          // Finished target passes
+    uint32_t passesDetected;  // Passes with an alarm while the target was coupled at all
+    double seconds;           // Simulated time
+    double firmwareSeconds;   // Host time spent in the firmware main loop, outside __WFI and HAL_Delay
+} Sim_Stats_t;
+
+void Sim_Init(const Sim_Config_t *config);
+const Sim_Stats_t *Sim_Stats(void);
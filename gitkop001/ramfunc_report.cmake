@@ -0,0 +1,54 @@
+# Lists the functions linked into .ramfunc, largest first, with their total.
+# Run after the link:
+#   cmake -DELF=<file.elf> -DNM=<nm> -DOUT=<report.txt> -P ramfunc_report.cmake
+
+execute_process(
+    COMMAND ${NM} -S --defined-only ${ELF}
+    OUTPUT_VARIABLE symbols
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${ELF}")
+endif()
+
+string(REGEX MATCH "([0-9a-fA-F]+) [A-Za-z] _sramfunc\n" match "${symbols}")
+set(start ${CMAKE_MATCH_1})
+string(REGEX MATCH "([0-9a-fA-F]+) [A-Za-z] _eramfunc\n" match "${symbols}")
+set(end ${CMAKE_MATCH_1})
+if(NOT start OR NOT end)
+    message(FATAL_ERROR "${ELF} has no _sramfunc/_eramfunc, is the .ramfunc section in the linker script?")
+endif()
+math(EXPR start "0x${start}")
+math(EXPR end "0x${end}")
+
+# Sort key is the size zero padded to 8 digits, sorted descending
+string(REPLACE "\n" ";" lines "${symbols}")
+set(entries "")
+set(total 0)
+foreach(line IN LISTS lines)
+    if(line MATCHES "^([0-9a-fA-F]+) ([0-9a-fA-F]+) [tT] (.+)$")
+        math(EXPR address "0x${CMAKE_MATCH_1}")
+        if(address GREATER_EQUAL start AND address LESS end)
+            math(EXPR size "0x${CMAKE_MATCH_2}")
+            math(EXPR total "${total} + ${size}")
+            string(LENGTH "${size}" digits)
+            math(EXPR pad "8 - ${digits}")
+            string(REPEAT "0" ${pad} zeros)
+            list(APPEND entries "${zeros}${size} ${CMAKE_MATCH_3}")
+        endif()
+    endif()
+endforeach()
+list(SORT entries ORDER DESCENDING)
+
+math(EXPR span "${end} - ${start}")
+set(report "SRAM code (.ramfunc): ${total} bytes in functions, ${span} bytes in the section\n")
+foreach(entry IN LISTS entries)
+    string(REGEX MATCH "^0*([0-9]+) (.+)$" match "${entry}")
+    string(LENGTH "${CMAKE_MATCH_1}" digits)
+    math(EXPR pad "8 - ${digits}")
+    string(REPEAT " " ${pad} spaces)
+    string(APPEND report "${spaces}${CMAKE_MATCH_1}  ${CMAKE_MATCH_2}\n")
+endforeach()
+
+file(WRITE ${OUT} "${report}")
+message("${report}")
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Convert the row-major tables in Core/Src/ssd1306_fonts.c into glyphs laid
+out like the SSD1306 GDDRAM, written to Core/Src/ssd1306_fonts_columns.c.
+
+The driver mirrors the panel in both axes (screen x, y is buffer column
+127 - x, row 63 - y), so the glyphs are stored already rotated by 180 degrees:
+every glyph is ceil(height / 8) pages of width bytes, page 0 first. Byte k of
+page p is buffer column k of the glyph box, that is glyph column width - 1 - k,
+and its bit b is glyph row height - 1 - (8 * p + b). SSD1306_WriteChar then
+only shifts every column to the page boundary and merges whole bytes.
+
+Run after changing ssd1306_fonts.c:  python3 ssd1306_fontgen.py
+"""
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCE = os.path.join(HERE, "Core", "Src", "ssd1306_fonts.c")
+OUTPUT = os.path.join(HERE, "Core", "Src", "ssd1306_fonts_columns.c")
+
+FIRST_CHAR = 32
+TABLE = re.compile(
+    r"#ifdef (SSD1306_INCLUDE_FONT_\w+)\s*\n"
+    r"static const uint16_t Font(\d+)x(\d+) \[\] = \{(.*?)\n\};",
+    re.S,
+)
+
+
+def rotate(rows, width, height):
+    pages = (height + 7) // 8
+    out = []
+    for page in range(pages):
+        for k in range(width):
+            column = width - 1 - k
+            byte = 0
+            for bit in range(8):
+                row = height - 1 - (8 * page + bit)
+                if row >= 0 and rows[row] & (0x8000 >> column):
+                    byte |= 1 << bit
+            out.append(byte)
+    return out
+
+
+def convert(guard, width, height, body):
+    # Drop the comments first, "// ," would otherwise look like a value
+    body = re.sub(r"//[^\n]*", "", body)
+    values = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body)]
+    if len(values) % height:
+        raise ValueError(f"Font{width}x{height}: {len(values)} values is not a whole number of glyphs")
+    if width > 16 or height > 32:
+        raise ValueError(f"Font{width}x{height}: glyphs are limited to 16x32")
+
+    lines = [
+        f"#ifdef {guard}",
+        f"const uint8_t Font{width}x{height}_Columns[] = {{",
+    ]
+    for i in range(len(values) // height):
+        glyph = rotate(values[i * height:(i + 1) * height], width, height)
+        ch = chr(FIRST_CHAR + i)
+        # A trailing backslash would continue the comment onto the next glyph
+        name = {" ": "sp", "\\": "backslash"}.get(ch, ch)
+        lines.append(", ".join(f"0x{b:02X}" for b in glyph) + f",  // {name}")
+    lines += ["};", "#endif", ""]
+    return lines
+
+
+def main():
+    with open(SOURCE) as f:
+        source = f.read()
+
+    lines = [
+        "/* Generated by ssd1306_fontgen.py from ssd1306_fonts.c, do not edit. */",
+        "",
+        '#include "ssd1306_fonts.h"',
+        "",
+    ]
+    fonts = TABLE.findall(source)
+    for guard, width, height, body in fonts:
+        lines += convert(guard, int(width), int(height), body)
+
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(lines))
+    print(f"{len(fonts)} fonts written to {os.path.relpath(OUTPUT, HERE)}")
+
+
+if __name__ == "__main__":
+    main()
@@ -44,6 +44,21 @@ defined in linker script */
 .word	_sbss
 /* end address for the .bss section. defined in linker script */
 .word	_ebss
+/* start address for the initialization values of the .ramfunc section.
+defined in linker script */
+.word	_siramfunc
+/* start address for the .ramfunc section. defined in linker script */
+.word	_sramfunc
+/* end address for the .ramfunc section. defined in linker script */
+.word	_eramfunc
+/* start address for the .dma_buffer section. defined in linker script */
+.word	_sdma_buffer
+/* end address for the .dma_buffer section. defined in linker script */
+.word	_edma_buffer
+/* start address for the .dsp_data section. defined in linker script */
+.word	_sdsp_data
+/* end address for the .dsp_data section. defined in linker script */
+.word	_edsp_data
 
 .equ  BootRAM,        0xF1E0F85F
 /**
@@ -81,6 +96,25 @@ LoopCopyDataInit:
   cmp r4, r1
   bcc CopyDataInit
 
+/* Copy the code linked to run from SRAM (.ramfunc) */
+  ldr r0, =_sramfunc
+  ldr r1, =_eramfunc
+  ldr r2, =_siramfunc
+  movs r3, #0
+  b LoopCopyRamFunc
+
+CopyRamFunc:
+  ldr r4, [r2, r3]
+  str r4, [r0, r3]
+  adds r3, r3, #4
+
+LoopCopyRamFunc:
+  adds r4, r0, r3
+  cmp r4, r1
+  bcc CopyRamFunc
+  dsb                   /* code written as data, finish before fetching it */
+  isb
+
 /* Zero fill the bss segment. */
   ldr r2, =_sbss
   ldr r4, =_ebss
@@ -95,6 +129,31 @@ LoopFillZerobss:
   cmp r2, r4
   bcc FillZerobss
 
+/* Zero fill the SRAM2 DMA buffers and the SRAM3 DSP data */
+  ldr r2, =_sdma_buffer
+  ldr r4, =_edma_buffer
+  b LoopFillZeroDma
+
+FillZeroDma:
+  str  r3, [r2]
+  adds r2, r2, #4
+
+LoopFillZeroDma:
+  cmp r2, r4
+  bcc FillZeroDma
+
+  ldr r2, =_sdsp_data
+  ldr r4, =_edsp_data
+  b LoopFillZeroDsp
+
+FillZeroDsp:
+  str  r3, [r2]
+  adds r2, r2, #4
+
+LoopFillZeroDsp:
+  cmp r2, r4
+  bcc FillZeroDsp
+
 /* Call static constructors */
   bl __libc_init_array
 /* Call the application's entry point.*/
@@ -6,6 +6,7 @@ import csv
 import traceback
 
 from serial_manager import SerialManager
+from telemetry import decode_frame, TELEMETRY_PULSE, TELEMETRY_RECORD, TELEMETRY_PROFILE
 from visualizers import AVAILABLE_VIEWS
 
 class GitKopDebugger:
@@ -16,6 +17,12 @@ class GitKopDebugger:
         self.serial_mgr = SerialManager()
         
         self.current_data = [] 
+        # Pulse and record frames are numbered separately
+        self.last_sequence = {}
+        self.lost_frames = {TELEMETRY_PULSE: 0, TELEMETRY_RECORD: 0, TELEMETRY_PROFILE: 0}
+        # Acquisition loss counters from the last pulse frame
+        self.pulse_losses = None
+        self.record_writer = None
 
         self.active_views : list[ViewClass] = {} 
         
@@ -40,11 +47,20 @@ class GitKopDebugger:
         self.btn_connect = ttk.Button(control_frame, text="Polacz", command=self.toggle_connection)
         self.btn_connect.pack(side=tk.LEFT, padx=10)
 
+        # Runtime parameters: "list", "get <name>", "set <name> <value>"
+        self.command_entry = ttk.Entry(control_frame, width=30)
+        self.command_entry.pack(side=tk.LEFT, padx=5)
+        self.command_entry.bind("<Return>", lambda event: self.send_command())
+        ttk.Button(control_frame, text="Wyslij", command=self.send_command).pack(side=tk.LEFT, padx=5)
+
         self.btn_export = ttk.Button(control_frame, text="CSV", command=self.export_csv, state=tk.DISABLED)
         self.btn_export.pack(side=tk.RIGHT, padx=10)
         
         self.btn_png = ttk.Button(control_frame, text="SVG", command=self.export_png, state=tk.DISABLED)
         self.btn_png.pack(side=tk.RIGHT, padx=10)
+
+        self.btn_record = ttk.Button(control_frame, text="Nagrywaj", command=self.toggle_recording)
+        self.btn_record.pack(side=tk.RIGHT, padx=10)
         
         self.refresh_ports()
 
@@ -79,16 +95,106 @@ class GitKopDebugger:
             self.btn_connect.config(text="Connect")
             self.log_message("INFO", msg)
 
+    def send_command(self):
+        line = self.command_entry.get().strip()
+        if not line: return
+        if self.serial_mgr.send(line):
+            self.log_message("CMD", line)
+            self.command_entry.delete(0, tk.END)
+        else:
+            self.log_message("ERROR", "Not connected")
+
     def process_queue(self):
         count = 0
         while not self.serial_mgr.data_queue.empty() and count < 50:
-            line = self.serial_mgr.data_queue.get()
-            self.parse_line(line)
+            chunk = self.serial_mgr.data_queue.get()
+            self.parse_chunk(chunk)
             count += 1
         if count >= 50:
             self.log_message(f"Flooded with messages: {self.serial_mgr.data_queue.qsize()}")
         self.root.after(20, self.process_queue)
 
+    def parse_chunk(self, chunk):
+        frame = decode_frame(chunk)
+        if frame is None:
+            for line in chunk.decode('utf-8', errors='replace').splitlines():
+                line = line.strip()
+                if line:
+                    self.parse_line(line)
+            return
+
+        kind, sequence, values, special_vals = frame
+        last = self.last_sequence.get(kind)
+        if last is not None and sequence != (last + 1) & 0xFFFFFFFF:
+            self.lost_frames[kind] += (sequence - last - 1) & 0xFFFFFFFF
+            self.log_message("WARN", f"Frames lost: {self.lost_frames[kind]} (type {kind})")
+        self.last_sequence[kind] = sequence
+
+        if kind == TELEMETRY_PROFILE:
+            self.show_profile(values, special_vals)
+            return
+        if kind == TELEMETRY_RECORD:
+            self.save_record(sequence, values, special_vals)
+        if kind == TELEMETRY_PULSE:
+            self.check_losses(special_vals)
+        self.show_packet(values, special_vals, kind)
+
+    def check_losses(self, special_vals):
+        # blocks dropped, pulses dropped, missed, overwritten, ADC overruns
+        losses = (special_vals[9], special_vals[10], *special_vals[21:24])
+        if self.pulse_losses is not None and losses != self.pulse_losses:
+            self.log_message("WARN", "Pulse #{}: blocks dropped {}, late {}, missed {}, "
+                                     "overwritten {}, ADC overruns {}".format(special_vals[20], *losses))
+        self.pulse_losses = losses
+
+    def show_profile(self, stages, special_vals):
+        interval_ms, core_hz, budget = special_vals[1:4]
+        self.log_message("PROF", f"{interval_ms} ms, budget {budget} cycles per block")
+        for stage in stages:
+            if stage["count"] == 0:
+                continue
+            share = stage["mean"] * stage["count"] / max(interval_ms * core_hz / 1000, 1)
+            self.log_message("PROF", f"{stage['name']:>10}: n={stage['count']:<6} "
+                                     f"min {stage['min']:>7} mean {stage['mean']:>7} max {stage['max']:>7} "
+                                     f"({stage['max'] / max(budget, 1):6.1%} of budget, {share:6.2%} of CPU)")
+
+    def show_packet(self, values, special_vals, kind=TELEMETRY_PULSE):
+        self.current_data = values
+        self.btn_export.config(state=tk.NORMAL)
+        self.btn_png.config(state=tk.NORMAL)
+
+        current_tab_id = self.notebook.select()
+
+        if current_tab_id in self.active_views:
+            view = self.active_views[current_tab_id]
+            if view.frame_kind == kind:
+                view.update_view(values, special_vals)
+
+        if kind == TELEMETRY_RECORD:
+            ratio = len(values) * 2 / max(special_vals[4] + 2, 1)
+            self.log_message("DATA", f"Record: {len(values)} samples, k={special_vals[3]}, "
+                                     f"{ratio:.2f}x, {special_vals[6]:.1f} cycles/sample, "
+                                     f"1 of {special_vals[7]} bursts, {special_vals[8]} B dropped")
+        else:
+            self.log_message("DATA", f"Packet: {len(values)} samples")
+
+    def toggle_recording(self):
+        if self.record_writer is None:
+            path = filedialog.asksaveasfilename(defaultextension=".csv")
+            if not path: return
+            self.record_file = open(path, 'w', newline='')
+            self.record_writer = csv.writer(self.record_file)
+            self.record_writer.writerow(["Sequence", "Timestamp_ms", "SampleRate_Hz", "SampleBits", "Samples..."])
+            self.btn_record.config(text="Stop")
+        else:
+            self.record_file.close()
+            self.record_writer = None
+            self.btn_record.config(text="Nagrywaj")
+
+    def save_record(self, sequence, values, special_vals):
+        if self.record_writer is not None:
+            self.record_writer.writerow([sequence, special_vals[0], special_vals[1], special_vals[2], *values])
+
     def parse_line(self, line):
         if line.startswith("DATA[") and line.endswith("$"):
             try:
@@ -98,16 +204,7 @@ class GitKopDebugger:
                 special_part = line[main_end+1:-1].split()
                 special_vals = [float(x) for x in special_part]
 
-                self.current_data = values
-                self.btn_export.config(state=tk.NORMAL)
-                self.btn_png.config(state=tk.NORMAL)
-
-                current_tab_id = self.notebook.select()
-                
-                if current_tab_id in self.active_views:
-                    self.active_views[current_tab_id].update_view(values, special_vals)
-
-                self.log_message("DATA", f"Packet: {len(values)} samples")
+                self.show_packet(values, special_vals)
 
             except Exception:
                 self.log_message("ERROR", f"Parse error: {traceback.format_exc()}")
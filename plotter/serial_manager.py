@@ -45,14 +45,28 @@ class SerialManager:
                 pass
         return "Disconnected"
 
+    def send(self, line):
+        """Send one command line, see Core/Src/command.h for the syntax."""
+        if not self.is_connected:
+            return False
+        try:
+            self.serial_port.write(line.strip().encode('ascii') + b'\n')
+            return True
+        except Exception:
+            return False
+
     def _read_loop(self):
         """Internal loop running in background thread."""
+        buffer = b''
         while not self.stop_event.is_set() and self.serial_port and self.serial_port.is_open:
             try:
                 if self.serial_port.in_waiting:
-                    line = self.serial_port.readline().decode('utf-8', errors='replace').strip()
-                    if line:
-                        self.data_queue.put(line)
+                    # Binary frames end with 0x00, text in between is passed on as is
+                    buffer += self.serial_port.read(self.serial_port.in_waiting)
+                    *chunks, buffer = buffer.split(b'\x00')
+                    for chunk in chunks:
+                        if chunk:
+                            self.data_queue.put(chunk)
                 else:
                     time.sleep(0.005)
             except Exception:
@@ -0,0 +1,158 @@
+import struct
+import zlib
+
+# Mirrors the frame structs in gitkop001/Core/Src/telemetry.h
+TELEMETRY_VERSION = 6
+TELEMETRY_PULSE = 1
+TELEMETRY_RECORD = 2
+TELEMETRY_PROFILE = 3
+TELEMETRY_RAW = 0xFF
+PULSE_HEADER = struct.Struct("<BBHIIfIffiiiiiHHIIIIIIIIIIIIIIIIHHIB3x")
+RECORD_HEADER = struct.Struct("<BBHIIIIHHBBBxI")
+PROFILE_HEADER = struct.Struct("<BBBBIIIII")
+PROFILE_STAGE = struct.Struct("<12sIIII")
+
+# Mirrors rice.h
+RICE_ESCAPE = 24
+RICE_RAW_BITS = 17
+
+Q16 = 1.0 / 65536
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def rice_decode(payload, first, samples, k):
+    """Rebuild a record from its first sample and the Rice coded deltas."""
+    bits = int.from_bytes(payload, "big")
+    left = len(payload) * 8
+
+    def take(n):
+        nonlocal left
+        left -= n
+        if left < 0:
+            raise ValueError("truncated payload")
+        return (bits >> left) & ((1 << n) - 1)
+
+    values = [first]
+    for _ in range(samples - 1):
+        q = 0
+        while q < RICE_ESCAPE and take(1):
+            q += 1
+        z = take(RICE_RAW_BITS) if q == RICE_ESCAPE else (q << k) | take(k)
+        values.append((values[-1] + ((z >> 1) ^ -(z & 1))) & 0xFFFF)
+    return values
+
+
+def decode_record(frame):
+    (version, kind, samples, sequence, timestamp_ms, sample_rate, encode_cycles,
+     first, payload_bytes, rice_k, sample_bits, every, tx_dropped) = RECORD_HEADER.unpack_from(frame)
+
+    if len(frame) != RECORD_HEADER.size + payload_bytes + 4 or samples == 0:
+        return None
+
+    payload = frame[RECORD_HEADER.size:RECORD_HEADER.size + payload_bytes]
+    if rice_k == TELEMETRY_RAW:
+        if payload_bytes != (samples - 1) * 2:
+            return None
+        values = [first] + list(struct.unpack(f"<{samples - 1}H", payload))
+    else:
+        try:
+            values = rice_decode(payload, first, samples, rice_k)
+        except ValueError:
+            return None
+
+    special = [
+        timestamp_ms, sample_rate, sample_bits, rice_k, payload_bytes,
+        encode_cycles, encode_cycles / samples, every, tx_dropped,
+    ]
+    return TELEMETRY_RECORD, sequence, values, special
+
+
+def decode_profile(frame):
+    """Profiler dump: values is one dict per stage, special is
+    [timestamp, interval ms, core Hz, cycle budget]."""
+    (version, kind, stages, bins, sequence, timestamp_ms, interval_ms,
+     core_hz, cycle_budget) = PROFILE_HEADER.unpack_from(frame)
+
+    entry = PROFILE_STAGE.size + bins * 4
+    if len(frame) != PROFILE_HEADER.size + stages * entry + 4:
+        return None
+
+    values = []
+    for i in range(stages):
+        offset = PROFILE_HEADER.size + i * entry
+        name, count, low, high, mean = PROFILE_STAGE.unpack_from(frame, offset)
+        hist = struct.unpack_from(f"<{bins}I", frame, offset + PROFILE_STAGE.size)
+        values.append({
+            "name": name.rstrip(b"\0").decode("ascii", errors="replace"),
+            "count": count, "min": low, "max": high, "mean": mean, "hist": list(hist),
+        })
+
+    special = [timestamp_ms, interval_ms, core_hz, cycle_budget]
+    return TELEMETRY_PROFILE, sequence, values, special
+
+
+def decode_frame(chunk):
+    """Decode one COBS frame (without the 0x00 delimiter).
+
+    Returns (kind, sequence, values, special), or None if the chunk is not a
+    valid frame. For pulse frames special is laid out like the fields of the
+    old ASCII DATA line, for record frames it is [timestamp, sample rate,
+    sample bits, rice k, payload bytes, encode cycles, cycles per sample,
+    bursts per record, UART bytes dropped].
+    Profiler dumps are described in decode_profile.
+    """
+    frame = cobs_decode(chunk)
+    if frame is None or len(frame) < 2 + 4:
+        return None
+
+    crc, = struct.unpack_from("<I", frame, len(frame) - 4)
+    if zlib.crc32(frame[:-4]) != crc:
+        return None
+
+    if frame[0] != TELEMETRY_VERSION:
+        return None
+    if frame[1] == TELEMETRY_RECORD and len(frame) >= RECORD_HEADER.size + 4:
+        return decode_record(frame)
+    if frame[1] == TELEMETRY_PROFILE and len(frame) >= PROFILE_HEADER.size + 4:
+        return decode_profile(frame)
+    if len(frame) < PULSE_HEADER.size + 4:
+        return None
+
+    (version, kind, samples, sequence, timestamp_ms, time_us, time_ns_q8, value, tau,
+     fast, slow, sigma, threshold, alarm_rate, amplitude, residual,
+     block_cycles, block_cycles_max, block_cycle_budget, block_latency,
+     block_latency_max, blocks_dropped, pulses_dropped, pulse_sequence,
+     pulses_missed, pulses_overwritten, adc_overruns, crossing_ns_1,
+     crossing_ns_2, crossing_ns_3, crossing_tau_ns_12, crossing_tau_ns_23,
+     crossing_ratio, crossing_shape, tx_dropped,
+     alarm) = PULSE_HEADER.unpack_from(frame)
+
+    if version != TELEMETRY_VERSION or kind != TELEMETRY_PULSE:
+        return None
+    if len(frame) != PULSE_HEADER.size + samples * 2 + 4:
+        return None
+
+    values = list(struct.unpack_from(f"<{samples}H", frame, PULSE_HEADER.size))
+    special = [
+        timestamp_ms, time_us, value, tau, fast * Q16, slow * Q16,
+        block_cycles, block_cycles_max, block_cycle_budget, blocks_dropped, pulses_dropped,
+        amplitude, residual, sigma * Q16, threshold * Q16, alarm_rate * Q16,
+        alarm, tx_dropped, block_latency, block_latency_max,
+        pulse_sequence, pulses_missed, pulses_overwritten, adc_overruns,
+        crossing_ns_1, crossing_ns_2, crossing_ns_3, crossing_tau_ns_12, crossing_tau_ns_23,
+        crossing_ratio / 1024, crossing_shape / 1024, time_ns_q8 / 256,
+    ]
+    return TELEMETRY_PULSE, sequence, values, special
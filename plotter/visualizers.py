@@ -6,6 +6,8 @@ from matplotlib.backends.backend_tkagg import FigureCanvasTkAgg, NavigationToolb
 import numpy as np
 from collections import deque
 
+from telemetry import TELEMETRY_PULSE, TELEMETRY_RECORD
+
 AVAILABLE_VIEWS = []
 
 def register_view(cls):
@@ -14,6 +16,7 @@ def register_view(cls):
 
 class BasePlotTab(ttk.Frame):
     name = "Base Plot"
+    frame_kind = TELEMETRY_PULSE
 
     def __init__(self, parent):
         super().__init__(parent)
@@ -56,13 +59,31 @@ class TimeDomainTab(BasePlotTab):
         self.redraw()
 
 @register_view
-class Slope(BasePlotTab):
-    name = "Nachylenie"
+class RecordTab(BasePlotTab):
+    name = "Pełny rekord"
+    frame_kind = TELEMETRY_RECORD
+
+    def __init__(self, parent):
+        super().__init__(parent)
+        self.ax.set_xlabel("Czas (µs)")
+        self.ax.set_ylabel("Wartość ADC")
+
+        self.line_ref, = self.ax.plot([], [], '-', color='#1f77b4', linewidth=1)
+
+    def update_view(self, values, special):
+        sample_us = 1e6 / special[1]
+        self.line_ref.set_data([i * sample_us for i in range(len(values))], values)
+
+        self.redraw()
+
+@register_view
+class Tau(BasePlotTab):
+    name = "Stała zaniku"
 
     def __init__(self, parent):
         super().__init__(parent)
         self.ax.set_xlabel("Próbka")
-        self.ax.set_ylabel("Nachylenie (V/s)")
+        self.ax.set_ylabel("Tau (µs)")
         
         self.line_ref, = self.ax.plot([], [], 'o-', color='#1f77b4', linewidth=1, markersize=3)
         self.buffer = deque(maxlen=100) 
@@ -157,9 +178,12 @@ class EMASplitTab(BasePlotTab):
         self.ax2.set_ylabel("Wartość")
         self.ax2.grid(True, alpha=0.3)
         self.ema_line, = self.ax2.plot([], [], '-o',label='EMA', linewidth=2)
+        self.threshold_line, = self.ax2.plot([], [], '--', color='red', label='Próg', linewidth=1)
 
         self.raw = deque(maxlen=100) 
         self.filtered = deque(maxlen=100) 
+        self.threshold = deque(maxlen=100)
+        self.alarm = deque(maxlen=100)
         self.fill_collection = None
         self.vlines_collection = None
         self.figure.tight_layout()
@@ -167,6 +191,9 @@ class EMASplitTab(BasePlotTab):
     def update_view(self, values, special):
         self.raw.append(special[1])
         self.filtered.append(special[2])
+        # Adaptive detector: threshold and alarm state from the firmware
+        self.threshold.append(special[14])
+        self.alarm.append(special[16])
 
         arr_raw = np.array(self.raw)
         arr_filtered = np.array(self.filtered)
@@ -174,6 +201,7 @@ class EMASplitTab(BasePlotTab):
         
         self.raw_line.set_data(x_axis, arr_raw)
         self.ema_line.set_data(x_axis, arr_filtered)
+        self.threshold_line.set_data(x_axis, self.threshold)
         
         if self.fill_collection:
             self.fill_collection.remove()
@@ -182,7 +210,7 @@ class EMASplitTab(BasePlotTab):
             self.vlines_collection.remove()
             self.vlines_collection = None
 
-        alarm_mask = np.abs(self.filtered) > 1
+        alarm_mask = np.array(self.alarm) > 0
 
         self.fill_collection = self.ax2.fill_between(
             x_axis,